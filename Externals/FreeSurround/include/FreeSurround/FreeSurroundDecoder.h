@@ -177,11 +177,19 @@ private:
   // size (in samples)
   std::vector<std::vector<cplx>> signal;
 
+  // the channel maps of the current setup
+  const std::vector<std::vector<float *>> *alloc;
+
+  // which of the L/C/R phases each channel takes
+  std::vector<int> phase_index;
+
   // helper functions
   inline float sqr(double x);
   inline double amplitude(const cplx &x);
   inline double phase(const cplx &x);
   inline cplx polar(double a, double p);
+  inline cplx unit(const cplx &x);
+  inline double phase_difference(const cplx &a, const cplx &b);
   inline float min(double a, double b);
   inline float max(double a, double b);
   inline float clamp(double x);
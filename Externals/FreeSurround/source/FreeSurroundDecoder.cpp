@@ -53,6 +53,11 @@ void DPL2FSDecoder::Init(channel_setup chsetup, unsigned int blsize,
     forward = kiss_fftr_alloc(N, 0, 0, 0);
     inverse = kiss_fftr_alloc(N, 1, 0, 0);
     C = static_cast<unsigned int>(chn_alloc[setup].size());
+    // look up the channel maps once, instead of for every bin
+    alloc = &chn_alloc[setup];
+    phase_index.resize(C - 1);
+    for (unsigned int c = 0; c < C - 1; c++)
+      phase_index[c] = 1 + static_cast<int>(sign(chn_xsf[setup][c]));
 
     // Allocate per-channel buffers
     outbuf.resize((N + N / 2) * C);
@@ -129,6 +134,22 @@ inline double DPL2FSDecoder::phase(const cplx &x) {
 inline cplx DPL2FSDecoder::polar(double a, double p) {
   return cplx(a * cos(p), a * sin(p));
 }
+// polar(1, phase(x)), without the trigonometry
+inline cplx DPL2FSDecoder::unit(const cplx &x) {
+  double len = sqrt(x.real() * x.real() + x.imag() * x.imag());
+  return len > 0 ? x / len : cplx(1, 0);
+}
+// the absolute difference of phase(a) and phase(b), wrapped into [0, pi]
+inline double DPL2FSDecoder::phase_difference(const cplx &a, const cplx &b) {
+  // the angle between two vectors only takes one atan2, but the phase of a
+  // zero vector is taken as 0, and not as the phase of the other vector
+  if (b == cplx(0, 0))
+    return abs(phase(a));
+  if (a == cplx(0, 0))
+    return abs(phase(b));
+  return atan2(abs(a.imag() * b.real() - a.real() * b.imag()),
+               a.real() * b.real() + a.imag() * b.imag());
+}
 inline float DPL2FSDecoder::min(double a, double b) {
   return static_cast<float>(a < b ? a : b);
 }
@@ -166,15 +187,13 @@ void DPL2FSDecoder::buffered_decode(float *input) {
 
   // compute multichannel output signal in the spectral domain
   for (unsigned int f = 1; f < N / 2; f++) {
-    // get Lt/Rt amplitudes & phases
-    double ampL = amplitude(lf[f]), ampR = amplitude(rf[f]);
-    double phaseL = phase(lf[f]), phaseR = phase(rf[f]);
+    const cplx l = lf[f], r = rf[f];
+    // get Lt/Rt amplitudes & phase difference
+    double ampL = amplitude(l), ampR = amplitude(r);
     // calculate the amplitude & phase differences
     double ampDiff =
         clamp((ampL + ampR < epsilon) ? 0 : (ampR - ampL) / (ampR + ampL));
-    double phaseDiff = abs(phaseL - phaseR);
-    if (phaseDiff > pi)
-      phaseDiff = 2 * pi - phaseDiff;
+    double phaseDiff = phase_difference(l, r);
 
     // decode into x/y soundfield position
     double x, y;
@@ -193,10 +212,9 @@ void DPL2FSDecoder::buffered_decode(float *input) {
 
     // get total signal amplitude
     double amp_total = sqrt(ampL * ampL + ampR * ampR);
-    // and total L/C/R signal phases
-    double phase_of[] = {
-        phaseL, atan2(lf[f].imag() + rf[f].imag(), lf[f].real() + rf[f].real()),
-        phaseR};
+    // and the total L/C/R signal phases, as unit vectors, so that the output
+    // bins don't need any trigonometry
+    const cplx phase_of[] = {unit(l), unit(l + r), unit(r)};
     // compute 2d channel map indexes p/q and update x/y to fractional offsets
     // in the map grid
     int p = map_to_grid(x), q = map_to_grid(y);
@@ -205,11 +223,12 @@ void DPL2FSDecoder::buffered_decode(float *input) {
       // look up channel map at respective position (with bilinear
       // interpolation) and build the
       // signal
-      std::vector<float *> &a = chn_alloc[setup][c];
-      signal[c][f] = polar(
-          amp_total * ((1 - x) * (1 - y) * a[q][p] + x * (1 - y) * a[q][p + 1] +
-                       (1 - x) * y * a[q + 1][p] + x * y * a[q + 1][p + 1]),
-          phase_of[1 + static_cast<int>(sign(chn_xsf[setup][c]))]);
+      const std::vector<float *> &a = (*alloc)[c];
+      signal[c][f] =
+          amp_total *
+          ((1 - x) * (1 - y) * a[q][p] + x * (1 - y) * a[q][p + 1] +
+           (1 - x) * y * a[q + 1][p] + x * y * a[q + 1][p + 1]) *
+          phase_of[phase_index[c]];
     }
 
     // optionally redirect bass
@@ -219,7 +238,7 @@ void DPL2FSDecoder::buffered_decode(float *input) {
           f < lo_cut ? 1
                      : 0.5 * (1 + cos(pi * (f - lo_cut) / (hi_cut - lo_cut)));
       // assign LFE channel
-      signal[C - 1][f] = lfe_level * polar(amp_total, phase_of[1]);
+      signal[C - 1][f] = lfe_level * amp_total * phase_of[1];
       // subtract the signal from the other channels
       for (unsigned int c = 0; c < C - 1; c++)
         signal[c][f] *= (1 - lfe_level);
@@ -227,11 +246,14 @@ void DPL2FSDecoder::buffered_decode(float *input) {
   }
 
   // shift the last 2/3 to the first 2/3 of the output buffer
-  memcpy(&outbuf[0], &outbuf[C * N / 2], N * C * 4);
+  memmove(&outbuf[0], &outbuf[C * N / 2], N * C * 4);
   // and clear the rest
   memset(&outbuf[C * N], 0, C * 4 * N / 2);
   // backtransform each channel and overlap-add
   for (unsigned int c = 0; c < C; c++) {
+    // without bass redirection, the LFE channel is silent
+    if (c == C - 1 && !use_lfe)
+      continue;
     // back-transform into time domain
     kiss_fftri(inverse, (kiss_fft_cpx *)&signal[c][0], &dst[0]);
     // add the result to the last 2/3 of the output buffer, windowed (and
@@ -243,29 +265,20 @@ void DPL2FSDecoder::buffered_decode(float *input) {
 
 // transform amp/phase difference space into x/y soundfield space
 void DPL2FSDecoder::transform_decode(double a, double p, double &x, double &y) {
-  x = clamp(1.0047 * a + 0.46804 * a * p * p * p - 0.2042 * a * p * p * p * p +
-            0.0080586 * a * p * p * p * p * p * p * p -
-            0.0001526 * a * p * p * p * p * p * p * p * p * p * p -
-            0.073512 * a * a * a * p - 0.2499 * a * a * a * p * p * p * p +
-            0.016932 * a * a * a * p * p * p * p * p * p * p -
-            0.00027707 * a * a * a * p * p * p * p * p * p * p * p * p * p +
-            0.048105 * a * a * a * a * a * p * p * p * p * p * p * p -
-            0.0065947 * a * a * a * a * a * p * p * p * p * p * p * p * p * p *
-                p +
-            0.0016006 * a * a * a * a * a * p * p * p * p * p * p * p * p * p *
-                p * p -
-            0.0071132 * a * a * a * a * a * a * a * p * p * p * p * p * p * p *
-                p * p +
-            0.0022336 * a * a * a * a * a * a * a * p * p * p * p * p * p * p *
-                p * p * p * p -
-            0.0004804 * a * a * a * a * a * a * a * p * p * p * p * p * p * p *
-                p * p * p * p * p);
-  y = clamp(
-      0.98592 - 0.62237 * p + 0.077875 * p * p - 0.0026929 * p * p * p * p * p +
-      0.4971 * a * a * p - 0.00032124 * a * a * p * p * p * p * p * p +
-      9.2491e-006 * a * a * a * a * p * p * p * p * p * p * p * p * p * p +
-      0.051549 * a * a * a * a * a * a * a * a +
-      1.0727e-014 * a * a * a * a * a * a * a * a * a * a);
+  // the same polynomials as always, with the powers computed only once
+  const double a2 = a * a, a3 = a2 * a, a4 = a2 * a2, a5 = a4 * a,
+               a7 = a5 * a2, a8 = a4 * a4, a10 = a8 * a2;
+  const double p2 = p * p, p3 = p2 * p, p4 = p2 * p2, p5 = p4 * p,
+               p6 = p4 * p2, p7 = p6 * p, p8 = p4 * p4, p9 = p8 * p,
+               p10 = p8 * p2, p11 = p10 * p, p12 = p8 * p4;
+  x = clamp(1.0047 * a + 0.46804 * a * p3 - 0.2042 * a * p4 +
+            0.0080586 * a * p7 - 0.0001526 * a * p10 - 0.073512 * a3 * p -
+            0.2499 * a3 * p4 + 0.016932 * a3 * p7 - 0.00027707 * a3 * p10 +
+            0.048105 * a5 * p7 - 0.0065947 * a5 * p10 + 0.0016006 * a5 * p11 -
+            0.0071132 * a7 * p9 + 0.0022336 * a7 * p11 - 0.0004804 * a7 * p12);
+  y = clamp(0.98592 - 0.62237 * p + 0.077875 * p2 - 0.0026929 * p5 +
+            0.4971 * a2 * p - 0.00032124 * a2 * p6 + 9.2491e-006 * a4 * p10 +
+            0.051549 * a8 + 1.0727e-014 * a10);
 }
 
 // apply a circular_wrap transformation to some position
@@ -12,4 +12,12 @@ enum class DPL2Quality : int
   High = 2,
   Highest = 3
 };
+
+enum class TimeStretchQuality : int
+{
+  Off = 0,
+  Low = 1,
+  Medium = 2,
+  High = 3
+};
 }  // namespace AudioCommon
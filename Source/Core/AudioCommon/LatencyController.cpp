@@ -0,0 +1,56 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/LatencyController.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace AudioCommon
+{
+// How fast the lateness peak is forgotten
+constexpr DT_s JITTER_DECAY_TIME = DT_s(5.0);
+// Each underrun adds this much latency, which is given back once there were no underruns for
+// UNDERRUN_HOLD_TIME
+constexpr double UNDERRUN_MARGIN_STEP_MS = 4.0;
+constexpr DT_s UNDERRUN_HOLD_TIME = DT_s(10.0);
+constexpr DT_s UNDERRUN_DECAY_TIME = DT_s(10.0);
+
+LatencyController::LatencyController(double min_ms, double max_ms)
+    : m_min_ms(min_ms), m_max_ms(max_ms), m_target_ms(max_ms)
+{
+}
+
+void LatencyController::SetLimits(double min_ms, double max_ms)
+{
+  m_min_ms = min_ms;
+  m_max_ms = std::max(min_ms, max_ms);
+  m_target_ms = std::clamp(m_target_ms, m_min_ms, m_max_ms);
+}
+
+void LatencyController::Update(DT interval, double requested_ms, bool underrun)
+{
+  // A single stall longer than the whole range says nothing about how the backend usually behaves
+  const double lateness_ms = std::clamp(DT_ms(interval).count() - requested_ms, 0.0, m_max_ms);
+  const double jitter_decay = std::exp(-DT_s(interval) / JITTER_DECAY_TIME);
+  m_jitter_ms = std::max(lateness_ms, m_jitter_ms * jitter_decay);
+
+  if (underrun)
+  {
+    m_underrun_margin_ms = std::min(m_underrun_margin_ms + UNDERRUN_MARGIN_STEP_MS, m_max_ms);
+    m_time_since_underrun = DT::zero();
+  }
+  else
+  {
+    m_time_since_underrun += interval;
+    if (m_time_since_underrun > UNDERRUN_HOLD_TIME)
+      m_underrun_margin_ms *= std::exp(-DT_s(interval) / UNDERRUN_DECAY_TIME);
+  }
+
+  // When the queue grows past the target, the mixer skips ahead to leave only half of it queued,
+  // and that half still has to last until the next callback even if it comes late.
+  const double needed_ms = requested_ms + m_jitter_ms + m_underrun_margin_ms;
+  m_target_ms = std::clamp(2.0 * needed_ms, m_min_ms, m_max_ms);
+}
+}  // namespace AudioCommon
@@ -0,0 +1,40 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// Picks how much audio the mixer should keep queued, for the lowest latency that doesn't crackle.
+//
+// The queue has to cover how late the audio callback can be, so the target follows the worst
+// lateness seen recently, which slowly decays. Underruns show that this wasn't enough and add a
+// safety margin on top, which is only given back after a long time without any.
+class LatencyController
+{
+public:
+  LatencyController(double min_ms, double max_ms);
+
+  void SetLimits(double min_ms, double max_ms);
+
+  // Called from the audio callback. interval is the time since the previous callback and
+  // requested_ms how much audio the callback asked for.
+  void Update(DT interval, double requested_ms, bool underrun);
+
+  double GetTargetMs() const { return m_target_ms; }
+  double GetJitterMs() const { return m_jitter_ms; }
+
+private:
+  double m_min_ms;
+  double m_max_ms;
+  double m_target_ms;
+
+  // Decaying peak of how much later than expected the callback ran
+  double m_jitter_ms = 0.0;
+  // Extra latency added because of underruns
+  double m_underrun_margin_ms = 0.0;
+  DT m_time_since_underrun{};
+};
+}  // namespace AudioCommon
@@ -7,6 +7,12 @@
 #include <cmath>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -35,10 +41,12 @@ static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 Mixer::Mixer(u32 BackendSampleRate)
     : m_output_sample_rate(BackendSampleRate),
       m_surround_decoder(BackendSampleRate,
-                         DPL2QualityToFrameBlockSize(Config::Get(Config::MAIN_DPL2_QUALITY)))
+                         DPL2QualityToFrameBlockSize(Config::Get(Config::MAIN_DPL2_QUALITY))),
+      m_time_stretcher(BackendSampleRate, Config::Get(Config::MAIN_AUDIO_TIME_STRETCH_QUALITY))
 {
   m_config_changed_callback_id = Config::AddConfigChangedCallback([this] { RefreshConfig(); });
   RefreshConfig();
+  m_buffer_target_ms = static_cast<float>(m_config_audio_buffer_ms);
 
   INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer is initialized");
 }
@@ -58,6 +66,69 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
+// Computes one output sample from the six samples of each granule around it. The granules are
+// pre-windowed, so they can simply be added together.
+Mixer::MixerFifo::StereoPair Mixer::MixerFifo::Interpolate(const StereoPair* front,
+                                                           const StereoPair* back, float t1)
+{
+  // Polynomial Interpolators for High-Quality Resampling of
+  // Over Sampled Audio by Olli Niemitalo, October 2001.
+  // Page 43 -- 6-point, 3rd-order Hermite:
+  // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
+  const float t2 = t1 * t1;
+  const float t3 = t2 * t1;
+  const float c0 = (+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f;
+  const float c1 = (+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f;
+  const float c2 = (+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f;
+  const float c3 = (+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f;
+  const float c4 = (+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f;
+  const float c5 = (+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f;
+
+  // Each vector holds two taps of both channels. The even and the odd taps are summed up
+  // separately, and the scalar version adds them up in the same order so all of them round alike.
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  static_assert(sizeof(StereoPair) == 2 * sizeof(float));
+  const float* const f = &front->l;
+  const float* const b = &back->l;
+#endif
+
+#if defined(_M_X86_64)
+  const __m128 s01 = _mm_add_ps(_mm_loadu_ps(f), _mm_loadu_ps(b));
+  const __m128 s23 = _mm_add_ps(_mm_loadu_ps(f + 4), _mm_loadu_ps(b + 4));
+  const __m128 s45 = _mm_add_ps(_mm_loadu_ps(f + 8), _mm_loadu_ps(b + 8));
+
+  __m128 sum = _mm_mul_ps(s01, _mm_setr_ps(c0, c0, c1, c1));
+  sum = _mm_add_ps(sum, _mm_mul_ps(s23, _mm_setr_ps(c2, c2, c3, c3)));
+  sum = _mm_add_ps(sum, _mm_mul_ps(s45, _mm_setr_ps(c4, c4, c5, c5)));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+
+  return StereoPair{_mm_cvtss_f32(sum), _mm_cvtss_f32(_mm_shuffle_ps(sum, sum, 1))};
+#elif defined(_M_ARM_64)
+  const float32x4_t s01 = vaddq_f32(vld1q_f32(f), vld1q_f32(b));
+  const float32x4_t s23 = vaddq_f32(vld1q_f32(f + 4), vld1q_f32(b + 4));
+  const float32x4_t s45 = vaddq_f32(vld1q_f32(f + 8), vld1q_f32(b + 8));
+
+  // Multiplies and adds are kept separate, as a fused multiply-add would round differently
+  const std::array<float, 12> coefficients = {c0, c0, c1, c1, c2, c2, c3, c3, c4, c4, c5, c5};
+  float32x4_t sum = vmulq_f32(s01, vld1q_f32(coefficients.data()));
+  sum = vaddq_f32(sum, vmulq_f32(s23, vld1q_f32(coefficients.data() + 4)));
+  sum = vaddq_f32(sum, vmulq_f32(s45, vld1q_f32(coefficients.data() + 8)));
+  const float32x2_t result = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+
+  return StereoPair{vget_lane_f32(result, 0), vget_lane_f32(result, 1)};
+#else
+  const StereoPair s0 = front[0] + back[0];
+  const StereoPair s1 = front[1] + back[1];
+  const StereoPair s2 = front[2] + back[2];
+  const StereoPair s3 = front[3] + back[3];
+  const StereoPair s4 = front[4] + back[4];
+  const StereoPair s5 = front[5] + back[5];
+
+  return (s0 * StereoPair{c0} + s2 * StereoPair{c2} + s4 * StereoPair{c4}) +
+         (s1 * StereoPair{c1} + s3 * StereoPair{c3} + s5 * StereoPair{c5});
+#endif
+}
+
 // Executed from sound stream thread
 void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 {
@@ -68,11 +139,15 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
   // We need at least a double because the index jump has 24 bits of fractional precision.
   const double out_sample_rate = m_mixer->m_output_sample_rate;
   double in_sample_rate =
-      static_cast<double>(FIXED_SAMPLE_RATE_DIVIDEND) / m_input_sample_rate_divisor;
+      static_cast<double>(FIXED_SAMPLE_RATE_DIVIDEND) / m_input_sample_rate_divisor.load();
 
+  // When time stretching, the sources play at their own pitch and the stretcher follows the speed
   const double emulation_speed = m_mixer->m_config_emulation_speed;
-  if (0 < emulation_speed && emulation_speed != 1.0)
+  if (0 < emulation_speed && emulation_speed != 1.0 &&
+      m_mixer->m_config_time_stretch_quality == AudioCommon::TimeStretchQuality::Off)
+  {
     in_sample_rate *= emulation_speed;
+  }
 
   const double base = static_cast<double>(1 << GRANULE_FRAC_BITS);
   const u32 index_jump = std::lround(base * in_sample_rate / out_sample_rate);
@@ -85,7 +160,7 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
   const StereoPair volume{m_LVolume.load() / 256.0f, m_RVolume.load() / 256.0f};
 
   // Calculate the ideal length of the granule queue.
-  const std::size_t buffer_size_ms = m_mixer->m_config_audio_buffer_ms;
+  const double buffer_size_ms = m_mixer->m_buffer_target_ms;
   const std::size_t buffer_size_samples = std::llround(buffer_size_ms * in_sample_rate / 1000.0);
 
   // Limit the possible queue sizes to any number between 4 and 64.
@@ -97,8 +172,32 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 
   m_granule_queue_size.store(buffer_size_granules, std::memory_order_relaxed);
 
-  while (num_samples-- > 0)
+  while (num_samples > 0)
   {
+    // Sources which aren't playing anything would only add silence until the next granule is
+    // dequeued, so that part can be skipped. As long as the quantization error is below half a
+    // sample, it leaves the output as is and stays the same.
+    if (m_front_silent && m_back_silent && index_jump != 0 &&
+        std::abs(m_quantization_error.l) < 0.5f && std::abs(m_quantization_error.r) < 0.5f)
+    {
+      const u64 index_in_half = m_current_index & (INDEX_HALF - 1);
+      const u64 steps_to_dequeue = (INDEX_HALF - index_in_half + index_jump - 1) / index_jump;
+      const std::size_t skipped = std::min<u64>(steps_to_dequeue - 1, num_samples);
+      if (skipped != 0)
+      {
+        m_current_index += static_cast<u32>(skipped * index_jump);
+
+        const float fade_target = fade_audio ? 0.0f : 1.0f;
+        const float fade_mul = fade_audio ? fade_out_mul : fade_in_mul;
+        m_fade_volume = fade_target + (m_fade_volume - fade_target) *
+                                          std::pow(1.0f - fade_mul, static_cast<float>(skipped));
+
+        samples += skipped * 2;
+        num_samples -= skipped;
+        continue;
+      }
+    }
+
     // The indexes for the front and back buffers are offset by 50% of the granule size.
     // We use the modular nature of 32-bit integers to wrap around the granule size.
     m_current_index += index_jump;
@@ -108,35 +207,15 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
     // If either index is less than the index jump, that means we reached
     // the end of the of the buffer and need to load the next granule.
     if (front_index < index_jump)
-      fade_audio = Dequeue(&m_front);
+      fade_audio = Dequeue(&m_front, &m_front_silent);
     else if (back_index < index_jump)
-      fade_audio = Dequeue(&m_back);
-
-    // The Granules are pre-windowed, so we can just add them together
-    const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
-    const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
-    const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
-    const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
-    const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
-    const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
-    const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
-    const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
-
-    // Polynomial Interpolators for High-Quality Resampling of
-    // Over Sampled Audio by Olli Niemitalo, October 2001.
-    // Page 43 -- 6-point, 3rd-order Hermite:
-    // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
-    const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
-    const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
-    const float t2 = t1 * t1;
-    const float t3 = t2 * t1;
+      fade_audio = Dequeue(&m_back, &m_back_silent);
 
-    StereoPair sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
-                         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
-                         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
-                         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
-                         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
-                         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
+    const std::size_t ft = ((front_index >> GRANULE_FRAC_BITS) - 2) & GRANULE_MASK;
+    const std::size_t bt = ((back_index >> GRANULE_FRAC_BITS) - 2) & GRANULE_MASK;
+    const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
+    StereoPair sample = Interpolate(&m_front[ft], &m_back[bt],
+                                    t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS));
 
     // Apply Fade In / Fade Out depending on if we are looping
     if (fade_audio)
@@ -157,14 +236,12 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
     m_quantization_error.r = std::clamp(samples[1] - sample.r, -1.0f, 1.0f);
 
     samples += 2;
+    num_samples--;
   }
 }
 
-std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
+void Mixer::MixSources(s16* samples, std::size_t num_samples)
 {
-  if (!samples)
-    return 0;
-
   memset(samples, 0, num_samples * 2 * sizeof(s16));
 
   m_dma_mixer.Mix(samples, num_samples);
@@ -173,6 +250,51 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   m_skylander_portal_mixer.Mix(samples, num_samples);
   for (auto& mixer : m_gba_mixers)
     mixer.Mix(samples, num_samples);
+}
+
+std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
+{
+  if (!samples)
+    return 0;
+
+  UpdateBufferTarget(num_samples);
+
+  const AudioCommon::TimeStretchQuality stretch_quality = m_config_time_stretch_quality;
+  if (stretch_quality == AudioCommon::TimeStretchQuality::Off || !IsOutputSampleRateValid())
+  {
+    if (m_stretch_active.exchange(false, std::memory_order_relaxed))
+      m_time_stretcher.Clear();
+    MixSources(samples, num_samples);
+    return num_samples;
+  }
+
+  const double tempo = UpdateStretchTempo();
+  m_time_stretcher.Configure(m_output_sample_rate, stretch_quality);
+  m_time_stretcher.SetTempo(tempo);
+
+  // The stretcher takes a whole segment of input at once, which would drain the DMA queue in
+  // bursts. So the sources are mixed at the rate the stretcher uses them up on average, and only
+  // more than that when it runs short, like when starting out or speeding up.
+  constexpr std::size_t max_frames = 0x400;
+  std::array<s16, max_frames * 2> buffer;
+  m_stretch_input_fraction += tempo * num_samples;
+  std::size_t input_frames = static_cast<std::size_t>(m_stretch_input_fraction);
+  m_stretch_input_fraction -= input_frames;
+  while (input_frames > 0 || m_time_stretcher.GetAvailableFrames() < num_samples)
+  {
+    std::size_t needed = input_frames;
+    if (m_time_stretcher.GetAvailableFrames() < num_samples)
+      needed = std::max(needed, m_time_stretcher.GetInputFramesNeeded());
+    const std::size_t frames = std::min(needed, max_frames);
+    MixSources(buffer.data(), frames);
+    m_time_stretcher.PutFrames(buffer.data(), frames);
+    input_frames -= std::min(input_frames, frames);
+  }
+  m_time_stretcher.ReceiveFrames(samples, num_samples);
+
+  const double latency_ms = m_time_stretcher.GetLatencyFrames() * 1000.0 / m_output_sample_rate;
+  m_stretch_latency_ms.store(static_cast<float>(latency_ms), std::memory_order_relaxed);
+  m_stretch_active.store(true, std::memory_order_relaxed);
 
   return num_samples;
 }
@@ -182,34 +304,37 @@ std::size_t Mixer::MixSurround(float* samples, std::size_t num_samples)
   if (!num_samples)
     return 0;
 
-  memset(samples, 0, num_samples * SURROUND_CHANNELS * sizeof(float));
+  const TimePoint start = Clock::now();
 
-  std::size_t const needed_frames =
-      m_surround_decoder.QueryFramesNeededForSurroundOutput(num_samples);
-
-  constexpr std::size_t max_samples = 0x8000;
-  ASSERT_MSG(AUDIO, needed_frames <= max_samples,
-             "needed_frames would overflow m_scratch_buffer: {} -> {} > {}", num_samples,
-             needed_frames, max_samples);
-
-  std::array<s16, max_samples> buffer;
-  std::size_t const available_frames = Mix(buffer.data(), static_cast<std::size_t>(needed_frames));
-  if (available_frames != needed_frames)
+  // The decoder thread gets exactly as many stereo frames as surround frames are taken out, so the
+  // mixer is called just like it is for stereo output.
+  constexpr std::size_t max_frames = 0x1000;
+  std::array<s16, max_frames * 2> buffer;
+  for (std::size_t offset = 0; offset < num_samples; offset += max_frames)
   {
-    ERROR_LOG_FMT(AUDIO,
-                  "Error decoding surround frames: needed {} frames for {} samples but got {}",
-                  needed_frames, num_samples, available_frames);
-    return 0;
+    const std::size_t frames = std::min(num_samples - offset, max_frames);
+    Mix(buffer.data(), frames);
+    m_surround_decoder.PutFrames(buffer.data(), frames);
+    m_surround_decoder.ReceiveFrames(&samples[offset * SURROUND_CHANNELS], frames);
   }
 
-  m_surround_decoder.PutFrames(buffer.data(), needed_frames);
-  m_surround_decoder.ReceiveFrames(samples, num_samples);
+  // A running average, and a peak that decays over a few hundred callbacks
+  const float callback_us = static_cast<float>(DT_us(Clock::now() - start).count());
+  const float average_us = m_surround_callback_us.load(std::memory_order_relaxed);
+  const float peak_us = m_surround_peak_callback_us.load(std::memory_order_relaxed);
+  m_surround_callback_us.store(average_us + (callback_us - average_us) / 16,
+                               std::memory_order_relaxed);
+  m_surround_peak_callback_us.store(std::max(callback_us, peak_us * 0.99f),
+                                    std::memory_order_relaxed);
+  m_surround_active.store(true, std::memory_order_relaxed);
 
   return num_samples;
 }
 
 void Mixer::MixerFifo::PushSamples(const s16* samples, std::size_t num_samples)
 {
+  m_pushed_samples.fetch_add(num_samples, std::memory_order_relaxed);
+
   while (num_samples-- > 0)
   {
     const s16 l = m_little_endian ? samples[1] : Common::swap16(samples[1]);
@@ -321,6 +446,118 @@ void Mixer::PushGBASamples(std::size_t device_number, const s16* samples, std::s
   m_gba_mixers[device_number].PushSamples(samples, num_samples);
 }
 
+Mixer::BufferStatistics Mixer::GetDMABufferStatistics() const
+{
+  return m_dma_mixer.GetBufferStatistics();
+}
+
+Mixer::BufferStatistics Mixer::GetStreamingBufferStatistics() const
+{
+  return m_streaming_mixer.GetBufferStatistics();
+}
+
+Mixer::LatencyStatistics Mixer::GetLatencyStatistics() const
+{
+  const BufferStatistics dma = m_dma_mixer.GetBufferStatistics();
+
+  LatencyStatistics statistics;
+  statistics.latency_ms = dma.queued_ms + m_callback_period_ms.load(std::memory_order_relaxed);
+  statistics.target_ms = dma.target_ms;
+  statistics.jitter_ms = m_callback_jitter_ms.load(std::memory_order_relaxed);
+
+  if (m_surround_active.load(std::memory_order_relaxed) && IsOutputSampleRateValid())
+  {
+    const AudioCommon::SurroundDecoder::Statistics surround = m_surround_decoder.GetStatistics();
+    statistics.latency_ms += surround.latency_frames * 1000.0f / m_output_sample_rate;
+    statistics.surround_active = true;
+    statistics.surround_callback_us = m_surround_callback_us.load(std::memory_order_relaxed);
+    statistics.surround_peak_callback_us =
+        m_surround_peak_callback_us.load(std::memory_order_relaxed);
+    statistics.surround_decode_us = surround.decode_us;
+    statistics.surround_underruns = surround.underruns;
+  }
+
+  if (m_stretch_active.load(std::memory_order_relaxed))
+  {
+    statistics.latency_ms += m_stretch_latency_ms.load(std::memory_order_relaxed);
+    statistics.stretch_active = true;
+    statistics.stretch_tempo = m_stretch_tempo.load(std::memory_order_relaxed);
+  }
+  return statistics;
+}
+
+// Executed from sound stream thread
+void Mixer::UpdateBufferTarget(std::size_t num_samples)
+{
+  const TimePoint now = Clock::now();
+  const double requested_ms =
+      IsOutputSampleRateValid() ? num_samples * 1000.0 / m_output_sample_rate : 0.0;
+  m_callback_period_ms.store(static_cast<float>(requested_ms), std::memory_order_relaxed);
+
+  // Underruns of the DMA queue during the previous callback
+  const u64 underruns = m_dma_mixer.GetBufferStatistics().underruns;
+  const bool underrun = underruns != m_last_underruns;
+  m_last_underruns = underruns;
+
+  // The callback timing is only meaningful while the game produces audio
+  const bool is_running = Core::GetState(Core::System::GetInstance()) == Core::State::Running;
+  if (!m_config_adaptive_audio_buffer || !is_running || requested_ms == 0.0)
+  {
+    m_last_mix_time.reset();
+    if (!m_config_adaptive_audio_buffer)
+      m_buffer_target_ms = static_cast<float>(m_config_audio_buffer_ms);
+    return;
+  }
+
+  // The configured buffer size is the most latency the adaptive buffer goes up to
+  m_latency_controller.SetLimits(MIN_ADAPTIVE_BUFFER_MS, m_config_audio_buffer_ms);
+  if (m_last_mix_time)
+  {
+    m_latency_controller.Update(now - *m_last_mix_time, requested_ms, underrun);
+    m_callback_jitter_ms.store(static_cast<float>(m_latency_controller.GetJitterMs()),
+                               std::memory_order_relaxed);
+  }
+  m_last_mix_time = now;
+  m_buffer_target_ms = static_cast<float>(m_latency_controller.GetTargetMs());
+}
+
+// Executed from sound stream thread
+double Mixer::UpdateStretchTempo()
+{
+  // Follows how fast the DMA audio arrives, which is how fast the emulation runs. Short
+  // measurements would mostly see when the DSP happens to push its blocks.
+  constexpr DT_s MEASUREMENT_INTERVAL = DT_s(0.1);
+
+  const bool is_running = Core::GetState(Core::System::GetInstance()) == Core::State::Running;
+  const TimePoint now = Clock::now();
+  const u64 pushed_samples = m_dma_mixer.GetPushedSamples();
+  if (!is_running || !m_tempo_measure_start)
+  {
+    // Keeps the last tempo while paused, as nothing arrives then
+    m_tempo_measure_start = is_running ? std::optional(now) : std::nullopt;
+    m_tempo_measure_samples = pushed_samples;
+  }
+  else if (const DT_s elapsed = now - *m_tempo_measure_start; elapsed >= MEASUREMENT_INTERVAL)
+  {
+    const double input_sample_rate = static_cast<double>(FIXED_SAMPLE_RATE_DIVIDEND) /
+                                     m_dma_mixer.GetInputSampleRateDivisor();
+    const double speed =
+        (pushed_samples - m_tempo_measure_samples) / (elapsed.count() * input_sample_rate);
+    m_input_speed += (speed - m_input_speed) / 4;
+    m_tempo_measure_start = now;
+    m_tempo_measure_samples = pushed_samples;
+  }
+
+  // Steers the DMA queue back to its target, so the measurement errors don't add up
+  const BufferStatistics dma = m_dma_mixer.GetBufferStatistics();
+  const double correction = std::clamp((dma.queued_ms - dma.target_ms) / 1000.0, -0.05, 0.05);
+  const double tempo =
+      std::clamp(m_input_speed * (1.0 + correction), MIN_STRETCH_TEMPO, MAX_STRETCH_TEMPO);
+
+  m_stretch_tempo.store(static_cast<float>(tempo), std::memory_order_relaxed);
+  return tempo;
+}
+
 void Mixer::SetDMAInputSampleRateDivisor(u32 rate_divisor)
 {
   m_dma_mixer.SetInputSampleRateDivisor(rate_divisor);
@@ -432,6 +669,8 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_fill_audio_gaps = Config::Get(Config::MAIN_AUDIO_FILL_GAPS);
   m_config_audio_buffer_ms = Config::Get(Config::MAIN_AUDIO_BUFFER_SIZE);
+  m_config_adaptive_audio_buffer = Config::Get(Config::MAIN_AUDIO_ADAPTIVE_BUFFER);
+  m_config_time_stretch_quality = Config::Get(Config::MAIN_AUDIO_TIME_STRETCH_QUALITY);
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -462,6 +701,30 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
   return std::make_pair(m_LVolume.load(), m_RVolume.load());
 }
 
+Mixer::BufferStatistics Mixer::MixerFifo::GetBufferStatistics() const
+{
+  const std::size_t head = m_queue_head.load(std::memory_order_relaxed);
+  const std::size_t tail = m_queue_tail.load(std::memory_order_relaxed);
+  const std::size_t queued_granules = (head - tail) & GRANULE_QUEUE_MASK;
+  const std::size_t target_granules = m_granule_queue_size.load(std::memory_order_relaxed);
+
+  // Each granule adds GRANULE_OVERLAP new samples
+  const float ms_per_granule = GRANULE_OVERLAP * 1000.0f * m_input_sample_rate_divisor.load() /
+                               static_cast<float>(FIXED_SAMPLE_RATE_DIVIDEND);
+
+  BufferStatistics statistics;
+  statistics.queued_ms = queued_granules * ms_per_granule;
+  statistics.target_ms = target_granules * ms_per_granule;
+  statistics.underruns = m_underruns.load(std::memory_order_relaxed);
+  statistics.overflows = m_overflows.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+u64 Mixer::MixerFifo::GetPushedSamples() const
+{
+  return m_pushed_samples.load(std::memory_order_relaxed);
+}
+
 void Mixer::MixerFifo::Enqueue()
 {
   // import numpy as np
@@ -522,24 +785,32 @@ void Mixer::MixerFifo::Enqueue()
   std::size_t const next_head = (head + 1) & GRANULE_QUEUE_MASK;
   if (next_head == m_queue_tail.load(std::memory_order_acquire))
   {
+    m_overflows.fetch_add(1, std::memory_order_relaxed);
     WARN_LOG_FMT(AUDIO,
                  "Granule Queue has completely filled and audio samples are being dropped. "
                  "This should not happen unless the audio backend has stopped requesting audio.");
     return;
   }
 
-  // By preconstructing the granule window, we have the best chance of
-  // the compiler optimizing this loop using SIMD instructions.
+  // By preconstructing the granule window, we have the best chance of the compiler optimizing
+  // these loops using SIMD instructions. The next buffer is circular, so it's split in two parts
+  // to keep the accesses contiguous.
   const std::size_t start_index = m_next_buffer_index;
-  for (std::size_t i = 0; i < GRANULE_SIZE; ++i)
-    m_queue[head][i] = m_next_buffer[(i + start_index) & GRANULE_MASK] * GRANULE_WINDOW[i];
+  const std::size_t first_part = GRANULE_SIZE - start_index;
+  Granule& granule = m_queue[head];
+  for (std::size_t i = 0; i < first_part; ++i)
+    granule[i] = m_next_buffer[start_index + i] * GRANULE_WINDOW[i];
+  for (std::size_t i = first_part; i < GRANULE_SIZE; ++i)
+    granule[i] = m_next_buffer[i - first_part] * GRANULE_WINDOW[i];
+  m_queue_silent[head] = std::ranges::all_of(
+      m_next_buffer, [](const StereoPair& sample) { return sample.l == 0 && sample.r == 0; });
 
   m_queue_head.store(next_head, std::memory_order_release);
   m_queue_fading.store(false, std::memory_order_relaxed);
   m_queue_looping.store(false, std::memory_order_relaxed);
 }
 
-bool Mixer::MixerFifo::Dequeue(Granule* granule)
+bool Mixer::MixerFifo::Dequeue(PaddedGranule* granule, bool* silent)
 {
   const std::size_t granule_queue_size = m_granule_queue_size.load(std::memory_order_relaxed);
   const std::size_t head = m_queue_head.load(std::memory_order_acquire);
@@ -557,6 +828,8 @@ bool Mixer::MixerFifo::Dequeue(Granule* granule)
   std::size_t next_tail = (tail + 1) & GRANULE_QUEUE_MASK;
   if (next_tail == head)
   {
+    m_underruns.fetch_add(1, std::memory_order_relaxed);
+
     // Only fill gaps when running to prevent stutter on pause.
     const bool is_running = Core::GetState(Core::System::GetInstance()) == Core::State::Running;
     if (m_mixer->m_config_fill_audio_gaps && is_running)
@@ -573,13 +846,17 @@ bool Mixer::MixerFifo::Dequeue(Granule* granule)
     else
     {
       std::fill(granule->begin(), granule->end(), StereoPair{0.0f, 0.0f});
+      *silent = true;
       m_queue_fading.store(false, std::memory_order_relaxed);
       m_queue_looping.store(false, std::memory_order_relaxed);
       return false;
     }
   }
 
-  *granule = m_queue[tail];
+  const Granule& next_granule = m_queue[tail];
+  std::copy(next_granule.begin(), next_granule.end(), granule->begin());
+  std::copy_n(next_granule.begin(), INTERPOLATION_TAPS - 1, granule->begin() + GRANULE_SIZE);
+  *silent = m_queue_silent[tail];
   m_queue_tail.store(next_tail, std::memory_order_release);
 
   return m_queue_fading.load(std::memory_order_relaxed);
@@ -6,8 +6,11 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <optional>
 
+#include "AudioCommon/LatencyController.h"
 #include "AudioCommon/SurroundDecoder.h"
+#include "AudioCommon/TimeStretcher.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
@@ -17,6 +20,44 @@ class PointerWrap;
 class Mixer final
 {
 public:
+  // How full the queue of one of the audio sources is. Only meant for display and tuning, as the
+  // values keep changing while they are read.
+  struct BufferStatistics
+  {
+    // How much audio is waiting to be mixed, and how much the mixer tries to keep queued
+    float queued_ms = 0.0f;
+    float target_ms = 0.0f;
+    // How many times the queue ran empty while mixing
+    u64 underruns = 0;
+    // How many times samples were dropped because the queue was full
+    u64 overflows = 0;
+  };
+
+  // How long the emulated audio takes to get through the mixer, for display
+  struct LatencyStatistics
+  {
+    // Audio waiting in the DMA queue plus the audio handed to the backend in one callback
+    float latency_ms = 0.0f;
+    // How much audio the mixer currently tries to keep queued
+    float target_ms = 0.0f;
+    // How much later than expected the audio callback ran recently
+    float jitter_ms = 0.0f;
+
+    // Only set while Dolby Pro Logic II decoding is used. The surround callback time is how long
+    // mixing a callback's worth of surround audio took on average and at most recently. The
+    // decoding itself happens on another thread, and takes the decode time per block.
+    bool surround_active = false;
+    float surround_callback_us = 0.0f;
+    float surround_peak_callback_us = 0.0f;
+    float surround_decode_us = 0.0f;
+    u64 surround_underruns = 0;
+
+    // Only set while time stretching is used. The tempo is how much faster than normal the audio
+    // plays to keep up with the emulation.
+    bool stretch_active = false;
+    float stretch_tempo = 1.0f;
+  };
+
   explicit Mixer(u32 BackendSampleRate);
   ~Mixer();
 
@@ -48,6 +89,10 @@ public:
   void SetWiimoteSpeakerVolume(u32 lvolume, u32 rvolume);
   void SetGBAVolume(std::size_t device_number, u32 lvolume, u32 rvolume);
 
+  BufferStatistics GetDMABufferStatistics() const;
+  BufferStatistics GetStreamingBufferStatistics() const;
+  LatencyStatistics GetLatencyStatistics() const;
+
   void StartLogDTKAudio(const std::string& filename);
   void StopLogDTKAudio();
 
@@ -60,6 +105,18 @@ public:
 private:
   const std::size_t SURROUND_CHANNELS = 6;
 
+  // The lowest target the adaptive buffer goes down to. The queue itself never gets shorter than
+  // a few granules either way.
+  static constexpr double MIN_ADAPTIVE_BUFFER_MS = 10.0;
+
+  // How far time stretching slows down or speeds up the audio. Beyond that, the DMA queue runs
+  // empty or gets trimmed as it does without time stretching.
+  static constexpr double MIN_STRETCH_TEMPO = 0.25;
+  static constexpr double MAX_STRETCH_TEMPO = 4.0;
+
+  // Each of these is fed by a single emulation thread and read by the audio thread. The granule
+  // queue is a lock-free single producer, single consumer ring, so neither side ever waits for the
+  // other.
   class MixerFifo final
   {
     static constexpr std::size_t MAX_GRANULE_QUEUE_SIZE = 256;
@@ -97,13 +154,19 @@ private:
     static constexpr std::size_t GRANULE_BITS = std::countr_one(GRANULE_MASK);
     static constexpr std::size_t GRANULE_FRAC_BITS = 32 - GRANULE_BITS;
 
+    static constexpr std::size_t INTERPOLATION_TAPS = 6;
+
     using Granule = std::array<StereoPair, GRANULE_SIZE>;
+    // A granule followed by a copy of its first samples, so the interpolation taps never need to
+    // wrap around
+    using PaddedGranule = std::array<StereoPair, GRANULE_SIZE + INTERPOLATION_TAPS - 1>;
 
   public:
     MixerFifo(Mixer* mixer, u32 sample_rate_divisor, bool little_endian)
         : m_mixer(mixer), m_input_sample_rate_divisor(sample_rate_divisor),
           m_little_endian(little_endian)
     {
+      m_queue_silent.fill(true);
     }
     void DoState(PointerWrap& p);
     void PushSamples(const s16* samples, std::size_t num_samples);
@@ -112,20 +175,28 @@ private:
     u32 GetInputSampleRateDivisor() const;
     void SetVolume(u32 lvolume, u32 rvolume);
     std::pair<s32, s32> GetVolume() const;
+    BufferStatistics GetBufferStatistics() const;
+    // How many samples have been pushed in total
+    u64 GetPushedSamples() const;
 
   private:
     Mixer* m_mixer;
-    u32 m_input_sample_rate_divisor;
+    std::atomic<u32> m_input_sample_rate_divisor;
     bool m_little_endian;
 
     Granule m_next_buffer{};
     std::size_t m_next_buffer_index = 0;
 
     u32 m_current_index = 0;
-    Granule m_front, m_back;
+    PaddedGranule m_front{}, m_back{};
+    // Set while a granule only holds silence
+    bool m_front_silent = true;
+    bool m_back_silent = true;
 
     std::atomic<std::size_t> m_granule_queue_size{20};
     std::array<Granule, MAX_GRANULE_QUEUE_SIZE> m_queue;
+    // Whether each queued granule only holds silence
+    std::array<bool, MAX_GRANULE_QUEUE_SIZE> m_queue_silent;
     std::atomic<std::size_t> m_queue_head{0};
     std::atomic<std::size_t> m_queue_tail{0};
     std::atomic<bool> m_queue_fading{false};
@@ -133,16 +204,25 @@ private:
     float m_fade_volume = 1.0;
 
     void Enqueue();
-    bool Dequeue(Granule* granule);
+    bool Dequeue(PaddedGranule* granule, bool* silent);
+
+    static StereoPair Interpolate(const StereoPair* front, const StereoPair* back, float t1);
 
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
 
     StereoPair m_quantization_error;
+
+    std::atomic<u64> m_underruns{0};
+    std::atomic<u64> m_overflows{0};
+    std::atomic<u64> m_pushed_samples{0};
   };
 
   void RefreshConfig();
+  void UpdateBufferTarget(std::size_t num_samples);
+  double UpdateStretchTempo();
+  void MixSources(s16* samples, std::size_t num_samples);
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -159,12 +239,37 @@ private:
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
 
+  // Only used by the audio thread
+  AudioCommon::LatencyController m_latency_controller{MIN_ADAPTIVE_BUFFER_MS, 80.0};
+  std::optional<TimePoint> m_last_mix_time;
+  u64 m_last_underruns = 0;
+  float m_buffer_target_ms = 80.0f;
+  AudioCommon::TimeStretcher m_time_stretcher;
+  std::optional<TimePoint> m_tempo_measure_start;
+  u64 m_tempo_measure_samples = 0;
+  // How fast the DMA audio arrives compared to its sample rate, smoothed over a few measurements
+  double m_input_speed = 1.0;
+  double m_stretch_input_fraction = 0.0;
+
+  std::atomic<float> m_callback_period_ms{0.0f};
+  std::atomic<float> m_callback_jitter_ms{0.0f};
+
+  std::atomic<bool> m_surround_active{false};
+  std::atomic<float> m_surround_callback_us{0.0f};
+  std::atomic<float> m_surround_peak_callback_us{0.0f};
+
+  std::atomic<bool> m_stretch_active{false};
+  std::atomic<float> m_stretch_tempo{1.0f};
+  std::atomic<float> m_stretch_latency_ms{0.0f};
+
   bool m_log_dtk_audio = false;
   bool m_log_dsp_audio = false;
 
   float m_config_emulation_speed;
   bool m_config_fill_audio_gaps;
   int m_config_audio_buffer_ms;
+  bool m_config_adaptive_audio_buffer;
+  AudioCommon::TimeStretchQuality m_config_time_stretch_quality;
 
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
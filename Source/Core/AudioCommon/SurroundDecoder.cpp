@@ -3,90 +3,180 @@
 
 #include "AudioCommon/SurroundDecoder.h"
 
-#include <FreeSurround/FreeSurroundDecoder.h>
+#include <algorithm>
+#include <chrono>
 #include <limits>
 
+#include <FreeSurround/FreeSurroundDecoder.h>
+
+#include "Common/Thread.h"
+
 namespace AudioCommon
 {
-constexpr size_t STEREO_CHANNELS = 2;
-constexpr size_t SURROUND_CHANNELS = 6;
-
 SurroundDecoder::SurroundDecoder(u32 sample_rate, u32 frame_block_size)
-    : m_sample_rate(sample_rate), m_frame_block_size(frame_block_size)
+    : m_sample_rate(sample_rate), m_frame_block_size(frame_block_size),
+      m_float_conversion_buffer(frame_block_size * STEREO_CHANNELS),
+      m_input_ring(RING_FRAMES * STEREO_CHANNELS), m_output_ring(RING_FRAMES * SURROUND_CHANNELS)
 {
   m_fsdecoder = std::make_unique<DPL2FSDecoder>();
   m_fsdecoder->Init(cs_5point1, m_frame_block_size, m_sample_rate);
 }
 
-SurroundDecoder::~SurroundDecoder() = default;
+SurroundDecoder::~SurroundDecoder()
+{
+  if (m_thread_running.TestAndClear())
+  {
+    m_input_event.Set();
+    m_thread.join();
+  }
+}
 
-void SurroundDecoder::Clear()
+// The worker thread is only started once surround output is actually used
+void SurroundDecoder::StartThread()
 {
-  m_fsdecoder->flush();
-  m_decoded_fifo.clear();
+  m_thread_running.Set();
+  m_thread = std::thread(&SurroundDecoder::ThreadLoop, this);
 }
 
-// Currently only 6 channels are supported.
-size_t SurroundDecoder::QueryFramesNeededForSurroundOutput(const size_t output_frames) const
+void SurroundDecoder::ThreadLoop()
 {
-  if (m_decoded_fifo.size() < output_frames * SURROUND_CHANNELS)
+  Common::SetCurrentThreadName("Surround Decoder");
+
+  while (m_thread_running.IsSet())
   {
-    // Output stereo frames needed to have at least the desired number of surround frames
-    size_t const frames_needed = output_frames - m_decoded_fifo.size() / SURROUND_CHANNELS;
-    return frames_needed + m_frame_block_size - frames_needed % m_frame_block_size;
-  }
+    m_input_event.Wait();
 
-  return 0;
+    while (m_input_head.load(std::memory_order_acquire) -
+               m_input_tail.load(std::memory_order_relaxed) >=
+           m_frame_block_size)
+    {
+      DecodeBlock();
+    }
+  }
 }
 
-// Receive and decode samples
-void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
+// Executed from the worker thread
+void SurroundDecoder::DecodeBlock()
 {
-  // Maybe check if it is really power-of-2?
-  s64 remaining_frames = static_cast<s64>(num_frames_in);
-  size_t frame_index = 0;
+  const TimePoint start = Clock::now();
 
-  while (remaining_frames > 0)
+  // Convert to float
+  const u64 input_tail = m_input_tail.load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < m_frame_block_size; ++i)
   {
-    // Convert to float
-    for (size_t i = 0, end = m_frame_block_size * STEREO_CHANNELS; i < end; ++i)
+    const std::size_t index = ((input_tail + i) & RING_MASK) * STEREO_CHANNELS;
+    for (std::size_t c = 0; c < STEREO_CHANNELS; ++c)
     {
-      m_float_conversion_buffer[i] = in[i + frame_index * STEREO_CHANNELS] /
-                                     static_cast<float>(std::numeric_limits<short>::max());
+      m_float_conversion_buffer[i * STEREO_CHANNELS + c] =
+          m_input_ring[index + c] / static_cast<float>(std::numeric_limits<short>::max());
     }
+  }
+  m_input_tail.store(input_tail + m_frame_block_size, std::memory_order_release);
 
-    // Decode
-    const float* dpl2_fs = m_fsdecoder->decode(m_float_conversion_buffer.data());
+  // Decode
+  const float* dpl2_fs = m_fsdecoder->decode(m_float_conversion_buffer.data());
 
-    // Add to ring buffer and fix channel mapping
-    // Maybe modify FreeSurround to output the correct mapping?
-    // FreeSurround:
-    // FL | FC | FR | BL | BR | LFE
-    // Most backends:
-    // FL | FR | FC | LFE | BL | BR
-    for (size_t i = 0; i < m_frame_block_size; ++i)
-    {
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 0]);  // LEFTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 2]);  // RIGHTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 1]);  // CENTREFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 5]);  // sub/lfe
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 3]);  // LEFTREAR
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 4]);  // RIGHTREAR
-    }
+  // Add to ring buffer and fix channel mapping
+  // Maybe modify FreeSurround to output the correct mapping?
+  // FreeSurround:
+  // FL | FC | FR | BL | BR | LFE
+  // Most backends:
+  // FL | FR | FC | LFE | BL | BR
+  const u64 output_head = m_output_head.load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < m_frame_block_size; ++i)
+  {
+    const float* in = &dpl2_fs[i * SURROUND_CHANNELS];
+    float* out = &m_output_ring[((output_head + i) & RING_MASK) * SURROUND_CHANNELS];
+    out[0] = in[0];  // LEFTFRONT
+    out[1] = in[2];  // RIGHTFRONT
+    out[2] = in[1];  // CENTREFRONT
+    out[3] = in[5];  // sub/lfe
+    out[4] = in[3];  // LEFTREAR
+    out[5] = in[4];  // RIGHTREAR
+  }
+  m_output_head.store(output_head + m_frame_block_size, std::memory_order_release);
 
-    remaining_frames = remaining_frames - static_cast<int>(m_frame_block_size);
-    frame_index = frame_index + m_frame_block_size;
+  m_decode_us.store(static_cast<float>(DT_us(Clock::now() - start).count()),
+                    std::memory_order_relaxed);
+}
+
+// Executed from sound stream thread
+void SurroundDecoder::PutFrames(const s16* in, std::size_t num_frames)
+{
+  if (!m_thread_running.IsSet())
+    StartThread();
+
+  // Frames that don't fit are dropped. Neither ring can fill up then, as both only ever hold
+  // frames that were put in but haven't been received yet.
+  const u64 input_head = m_input_head.load(std::memory_order_relaxed);
+  const u64 in_flight = input_head - m_output_tail.load(std::memory_order_relaxed);
+  const std::size_t capacity = RING_FRAMES - m_frame_block_size;
+  if (in_flight + num_frames > capacity)
+    num_frames = in_flight < capacity ? static_cast<std::size_t>(capacity - in_flight) : 0;
+
+  for (std::size_t i = 0; i < num_frames; ++i)
+  {
+    const std::size_t index = ((input_head + i) & RING_MASK) * STEREO_CHANNELS;
+    m_input_ring[index] = in[i * STEREO_CHANNELS];
+    m_input_ring[index + 1] = in[i * STEREO_CHANNELS + 1];
+  }
+  m_input_head.store(input_head + num_frames, std::memory_order_release);
+
+  if (input_head + num_frames - m_input_tail.load(std::memory_order_acquire) >= m_frame_block_size)
+  {
+    m_input_event.Set();
   }
 }
 
-void SurroundDecoder::ReceiveFrames(float* out, const size_t num_frames_out)
+// Executed from sound stream thread
+void SurroundDecoder::ReceiveFrames(float* out, std::size_t num_frames)
 {
-  // Copy to output array with desired num_frames_out
-  for (size_t i = 0, num_samples_output = num_frames_out * SURROUND_CHANNELS;
-       i < num_samples_output; ++i)
+  // With a block and two callbacks of frames in flight, a whole block has been put in before it is
+  // needed, and the worker has a whole callback to decode it.
+  const u64 target = m_frame_block_size + 2 * num_frames;
+  const u64 input_head = m_input_head.load(std::memory_order_relaxed);
+  u64 output_tail = m_output_tail.load(std::memory_order_relaxed);
+  const u64 output_head = m_output_head.load(std::memory_order_acquire);
+
+  if (!m_primed)
   {
-    out[i] = m_decoded_fifo.pop_front();
+    if (input_head - output_tail < target)
+    {
+      std::fill_n(out, num_frames * SURROUND_CHANNELS, 0.0f);
+      return;
+    }
+    m_primed = true;
+  }
+
+  // After underruns, skip the frames that came too late, so the latency stays bounded
+  if (input_head - output_tail > target + num_frames)
+    output_tail = std::min(input_head - target, output_head);
+
+  const std::size_t available = static_cast<std::size_t>(output_head - output_tail);
+  const std::size_t count = std::min(num_frames, available);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const float* frame = &m_output_ring[((output_tail + i) & RING_MASK) * SURROUND_CHANNELS];
+    std::copy_n(frame, SURROUND_CHANNELS, &out[i * SURROUND_CHANNELS]);
   }
+  std::fill(&out[count * SURROUND_CHANNELS], &out[num_frames * SURROUND_CHANNELS], 0.0f);
+  if (count < num_frames)
+    m_underruns.fetch_add(1, std::memory_order_relaxed);
+
+  m_output_tail.store(output_tail + count, std::memory_order_release);
+}
+
+SurroundDecoder::Statistics SurroundDecoder::GetStatistics() const
+{
+  Statistics statistics;
+  const u64 input_head = m_input_head.load(std::memory_order_relaxed);
+  statistics.latency_frames =
+      static_cast<u32>(input_head - m_output_tail.load(std::memory_order_relaxed));
+  statistics.undecoded_frames =
+      static_cast<u32>(input_head - m_output_head.load(std::memory_order_relaxed));
+  statistics.decode_us = m_decode_us.load(std::memory_order_relaxed);
+  statistics.underruns = m_underruns.load(std::memory_order_relaxed);
+  return statistics;
 }
 
 }  // namespace AudioCommon
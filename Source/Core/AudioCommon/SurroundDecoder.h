@@ -3,33 +3,83 @@
 
 #pragma once
 
-#include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/FixedSizeQueue.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 
 class DPL2FSDecoder;
 
 namespace AudioCommon
 {
+// Decodes stereo audio into 5.1 surround with FreeSurround. The decoder works on whole blocks,
+// which take too long to decode in the audio callback, so the blocks are decoded by a worker thread
+// instead. The audio thread hands the stereo frames over and takes the decoded frames back through
+// lock-free single producer, single consumer rings, and never waits for the worker.
 class SurroundDecoder
 {
 public:
+  struct Statistics
+  {
+    // How far behind the stereo input the surround output is
+    u32 latency_frames = 0;
+    // How many of the frames put in the worker thread hasn't decoded yet
+    u32 undecoded_frames = 0;
+    // How long the worker thread took for the last block
+    float decode_us = 0.0f;
+    // How many times the decoded frames weren't ready in time
+    u64 underruns = 0;
+  };
+
   explicit SurroundDecoder(u32 sample_rate, u32 frame_block_size);
   ~SurroundDecoder();
-  size_t QueryFramesNeededForSurroundOutput(const size_t output_frames) const;
-  void PutFrames(const short* in, const size_t num_frames_in);
-  void ReceiveFrames(float* out, const size_t num_frames_out);
-  void Clear();
+
+  // Called from the audio thread, with the same number of frames for each call pair. The frames
+  // taken out are always one block and two callbacks behind the frames put in, and are silent until
+  // enough frames have been decoded.
+  void PutFrames(const s16* in, std::size_t num_frames);
+  void ReceiveFrames(float* out, std::size_t num_frames);
+
+  Statistics GetStatistics() const;
 
 private:
+  static constexpr std::size_t STEREO_CHANNELS = 2;
+  static constexpr std::size_t SURROUND_CHANNELS = 6;
+  // Both rings hold a few of the largest blocks
+  static constexpr std::size_t RING_FRAMES = 0x4000;
+  static constexpr std::size_t RING_MASK = RING_FRAMES - 1;
+
+  void StartThread();
+  void ThreadLoop();
+  void DecodeBlock();
+
   u32 m_sample_rate;
   u32 m_frame_block_size;
 
   std::unique_ptr<DPL2FSDecoder> m_fsdecoder;
-  std::array<float, 32768> m_float_conversion_buffer;
-  Common::FixedSizeQueue<float, 32768> m_decoded_fifo;
+  std::vector<float> m_float_conversion_buffer;
+
+  // The positions are frame counts that only ever grow, and are only written by one side each
+  std::vector<s16> m_input_ring;
+  std::atomic<u64> m_input_head{0};
+  std::atomic<u64> m_input_tail{0};
+  std::vector<float> m_output_ring;
+  std::atomic<u64> m_output_head{0};
+  std::atomic<u64> m_output_tail{0};
+
+  // Only used by the audio thread
+  bool m_primed = false;
+
+  std::atomic<float> m_decode_us{0.0f};
+  std::atomic<u64> m_underruns{0};
+
+  std::thread m_thread;
+  Common::Flag m_thread_running;
+  Common::Event m_input_event;
 };
 
 }  // namespace AudioCommon
@@ -0,0 +1,271 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/TimeStretcher.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+#include "Common/MathUtil.h"
+
+namespace AudioCommon
+{
+namespace
+{
+struct Parameters
+{
+  double segment_ms;
+  double seek_ms;
+  double overlap_ms;
+  std::size_t seek_step;
+};
+
+Parameters GetParameters(TimeStretchQuality quality)
+{
+  switch (quality)
+  {
+  case TimeStretchQuality::High:
+    return {60.0, 20.0, 10.0, 1};
+  case TimeStretchQuality::Medium:
+    return {50.0, 15.0, 8.0, 2};
+  default:
+    return {40.0, 10.0, 5.0, 4};
+  }
+}
+
+// Returns how well the input lines up with the reference, regardless of how loud the input is.
+// num_values has to be a multiple of 4. The four running sums are added up in the same order on
+// every architecture.
+float Correlate(const float* reference, const float* input, std::size_t num_values)
+{
+#if defined(_M_X86_64)
+  __m128 dot = _mm_setzero_ps();
+  __m128 energy = _mm_setzero_ps();
+  for (std::size_t i = 0; i < num_values; i += 4)
+  {
+    const __m128 in = _mm_loadu_ps(input + i);
+    dot = _mm_add_ps(dot, _mm_mul_ps(in, _mm_loadu_ps(reference + i)));
+    energy = _mm_add_ps(energy, _mm_mul_ps(in, in));
+  }
+  dot = _mm_add_ps(dot, _mm_movehl_ps(dot, dot));
+  energy = _mm_add_ps(energy, _mm_movehl_ps(energy, energy));
+  const float dot_sum = _mm_cvtss_f32(_mm_add_ss(dot, _mm_shuffle_ps(dot, dot, 1)));
+  const float energy_sum = _mm_cvtss_f32(_mm_add_ss(energy, _mm_shuffle_ps(energy, energy, 1)));
+#elif defined(_M_ARM_64)
+  float32x4_t dot = vdupq_n_f32(0.0f);
+  float32x4_t energy = vdupq_n_f32(0.0f);
+  for (std::size_t i = 0; i < num_values; i += 4)
+  {
+    // Multiplies and adds are kept separate, as a fused multiply-add would round differently
+    const float32x4_t in = vld1q_f32(input + i);
+    dot = vaddq_f32(dot, vmulq_f32(in, vld1q_f32(reference + i)));
+    energy = vaddq_f32(energy, vmulq_f32(in, in));
+  }
+  const float32x2_t dot_pair = vadd_f32(vget_low_f32(dot), vget_high_f32(dot));
+  const float32x2_t energy_pair = vadd_f32(vget_low_f32(energy), vget_high_f32(energy));
+  const float dot_sum = vget_lane_f32(dot_pair, 0) + vget_lane_f32(dot_pair, 1);
+  const float energy_sum = vget_lane_f32(energy_pair, 0) + vget_lane_f32(energy_pair, 1);
+#else
+  std::array<float, 4> dot{};
+  std::array<float, 4> energy{};
+  for (std::size_t i = 0; i < num_values; i += 4)
+  {
+    for (std::size_t lane = 0; lane < 4; ++lane)
+    {
+      const float in = input[i + lane];
+      dot[lane] += in * reference[i + lane];
+      energy[lane] += in * in;
+    }
+  }
+  const float dot_sum = (dot[0] + dot[2]) + (dot[1] + dot[3]);
+  const float energy_sum = (energy[0] + energy[2]) + (energy[1] + energy[3]);
+#endif
+
+  // Silence lines up equally badly everywhere, instead of dividing by zero
+  return dot_sum / std::sqrt(energy_sum + 1.0f);
+}
+
+s16 ToSample(float value)
+{
+  return MathUtil::SaturatingCast<s16>(std::lround(value));
+}
+}  // namespace
+
+TimeStretcher::TimeStretcher(u32 sample_rate, TimeStretchQuality quality)
+{
+  Configure(sample_rate, quality);
+}
+
+void TimeStretcher::Configure(u32 sample_rate, TimeStretchQuality quality)
+{
+  if (quality == TimeStretchQuality::Off)
+    quality = TimeStretchQuality::Low;
+  if (sample_rate == m_sample_rate && quality == m_quality)
+    return;
+
+  m_sample_rate = sample_rate;
+  m_quality = quality;
+
+  const Parameters parameters = GetParameters(quality);
+  const auto to_frames = [sample_rate](double ms) {
+    return static_cast<std::size_t>(std::lround(ms * sample_rate / 1000.0));
+  };
+  // The correlation takes four values at a time, which are two stereo frames
+  m_overlap_frames = std::max<std::size_t>(to_frames(parameters.overlap_ms) & ~std::size_t(1), 2);
+  m_segment_frames = std::max(to_frames(parameters.segment_ms), m_overlap_frames * 2);
+  m_seek_frames = std::max<std::size_t>(to_frames(parameters.seek_ms), 1);
+  m_seek_step = parameters.seek_step;
+
+  Clear();
+}
+
+void TimeStretcher::Clear()
+{
+  m_skip_fraction = 0.0;
+  m_input.clear();
+  m_input_start = 0;
+  m_overlap.assign(m_overlap_frames * CHANNELS, 0.0f);
+  m_reference.assign(m_overlap_frames * CHANNELS, 0.0f);
+  m_output.clear();
+  m_output_start = 0;
+}
+
+void TimeStretcher::SetTempo(double tempo)
+{
+  m_tempo = tempo;
+}
+
+std::size_t TimeStretcher::GetInputFramesPerSegment() const
+{
+  // A segment can start anywhere in the seek range, and then the input moves on by the tempo
+  const std::size_t skip =
+      static_cast<std::size_t>(m_skip_fraction + m_tempo * (m_segment_frames - m_overlap_frames));
+  return std::max(m_seek_frames + m_segment_frames, skip);
+}
+
+std::size_t TimeStretcher::GetInputFramesNeeded() const
+{
+  const std::size_t needed = GetInputFramesPerSegment();
+  const std::size_t buffered = GetBufferedInputFrames();
+  return needed > buffered ? needed - buffered : 1;
+}
+
+void TimeStretcher::PutFrames(const s16* samples, std::size_t num_frames)
+{
+  if (m_input_start != 0)
+  {
+    m_input.erase(m_input.begin(), m_input.begin() + m_input_start * CHANNELS);
+    m_input_start = 0;
+  }
+
+  const std::size_t old_size = m_input.size();
+  m_input.resize(old_size + num_frames * CHANNELS);
+  std::copy_n(samples, num_frames * CHANNELS, m_input.begin() + old_size);
+
+  Process();
+}
+
+std::size_t TimeStretcher::ReceiveFrames(s16* samples, std::size_t num_frames)
+{
+  num_frames = std::min(num_frames, GetAvailableFrames());
+  const auto start = m_output.begin() + m_output_start * CHANNELS;
+  std::copy_n(start, num_frames * CHANNELS, samples);
+  m_output_start += num_frames;
+  return num_frames;
+}
+
+double TimeStretcher::GetLatencyFrames() const
+{
+  return GetAvailableFrames() + GetBufferedInputFrames() / m_tempo;
+}
+
+std::size_t TimeStretcher::FindBestOffset() const
+{
+  const float* const input = &m_input[m_input_start * CHANNELS];
+  const std::size_t num_values = m_overlap_frames * CHANNELS;
+
+  std::size_t best_offset = 0;
+  float best_correlation = Correlate(m_reference.data(), input, num_values);
+  const auto try_offset = [&](std::size_t offset) {
+    const float correlation = Correlate(m_reference.data(), input + offset * CHANNELS, num_values);
+    if (correlation > best_correlation)
+    {
+      best_correlation = correlation;
+      best_offset = offset;
+    }
+  };
+
+  for (std::size_t offset = m_seek_step; offset < m_seek_frames; offset += m_seek_step)
+    try_offset(offset);
+
+  // Then look closer around the best of the coarse positions
+  if (m_seek_step > 1)
+  {
+    const std::size_t coarse_offset = best_offset;
+    const std::size_t first = coarse_offset - std::min(coarse_offset, m_seek_step - 1);
+    const std::size_t last = std::min(coarse_offset + m_seek_step, m_seek_frames);
+    for (std::size_t offset = first; offset < last; ++offset)
+    {
+      if (offset != coarse_offset)
+        try_offset(offset);
+    }
+  }
+
+  return best_offset;
+}
+
+void TimeStretcher::Process()
+{
+  if (m_output_start != 0)
+  {
+    m_output.erase(m_output.begin(), m_output.begin() + m_output_start * CHANNELS);
+    m_output_start = 0;
+  }
+
+  const std::size_t output_frames = m_segment_frames - m_overlap_frames;
+  while (GetBufferedInputFrames() >= GetInputFramesPerSegment())
+  {
+    const float* const segment = &m_input[(m_input_start + FindBestOffset()) * CHANNELS];
+
+    const std::size_t output_size = m_output.size();
+    m_output.resize(output_size + output_frames * CHANNELS);
+    s16* const out = &m_output[output_size];
+
+    // Fade from the end of the previous segment into the start of this one, and play the rest of
+    // it except for its end, which is faded into the next segment
+    for (std::size_t i = 0; i < m_overlap_frames; ++i)
+    {
+      const float t = (i + 0.5f) / m_overlap_frames;
+      for (std::size_t channel = 0; channel < CHANNELS; ++channel)
+      {
+        const std::size_t index = i * CHANNELS + channel;
+        out[index] = ToSample(m_overlap[index] + (segment[index] - m_overlap[index]) * t);
+      }
+    }
+    for (std::size_t i = m_overlap_frames * CHANNELS; i < output_frames * CHANNELS; ++i)
+      out[i] = ToSample(segment[i]);
+
+    std::copy_n(segment + output_frames * CHANNELS, m_overlap_frames * CHANNELS,
+                m_overlap.begin());
+    const float half = m_overlap_frames / 2.0f;
+    for (std::size_t i = 0; i < m_overlap_frames; ++i)
+    {
+      const float weight = i * (m_overlap_frames - i) / (half * half);
+      for (std::size_t channel = 0; channel < CHANNELS; ++channel)
+        m_reference[i * CHANNELS + channel] = m_overlap[i * CHANNELS + channel] * weight;
+    }
+
+    m_skip_fraction += m_tempo * output_frames;
+    const auto skip = static_cast<std::size_t>(m_skip_fraction);
+    m_skip_fraction -= skip;
+    m_input_start += skip;
+  }
+}
+}  // namespace AudioCommon
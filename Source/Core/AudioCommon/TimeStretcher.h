@@ -0,0 +1,84 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "AudioCommon/Enums.h"
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// Changes the tempo of stereo audio without changing its pitch, with WSOLA (waveform similarity
+// overlap-add).
+//
+// The output is made of segments of the input which overlap a little and are crossfaded together.
+// Playing faster skips over more input between two segments, playing slower repeats some of it.
+// Each segment is moved by up to a few milliseconds to where its start lines up best with the end
+// of the previous segment, so the crossfades don't cancel out or smear the waveform. The quality
+// levels pick longer segments and a finer search for the best position, which costs more CPU.
+class TimeStretcher
+{
+public:
+  TimeStretcher(u32 sample_rate, TimeStretchQuality quality);
+
+  // Drops all buffered audio if either setting changes. Off is treated like Low, as the mixer
+  // simply doesn't use the stretcher then.
+  void Configure(u32 sample_rate, TimeStretchQuality quality);
+  void Clear();
+
+  // How much faster than the input the output plays, e.g. 2 for fast-forwarding at 200%. Takes
+  // effect from the next segment on.
+  void SetTempo(double tempo);
+  double GetTempo() const { return m_tempo; }
+
+  // How many more input frames are needed before more output frames become available. Never 0
+  // when none are available.
+  std::size_t GetInputFramesNeeded() const;
+
+  void PutFrames(const s16* samples, std::size_t num_frames);
+  std::size_t GetAvailableFrames() const { return m_output.size() / CHANNELS - m_output_start; }
+  // Takes up to num_frames frames out, and returns how many were taken
+  std::size_t ReceiveFrames(s16* samples, std::size_t num_frames);
+
+  // How far behind the input the output is, in output frames
+  double GetLatencyFrames() const;
+
+private:
+  static constexpr std::size_t CHANNELS = 2;
+
+  void Process();
+  std::size_t FindBestOffset() const;
+  std::size_t GetInputFramesPerSegment() const;
+  std::size_t GetBufferedInputFrames() const { return m_input.size() / CHANNELS - m_input_start; }
+
+  u32 m_sample_rate = 0;
+  TimeStretchQuality m_quality = TimeStretchQuality::Off;
+
+  // The length of a segment, how far a segment may be moved to line up with the previous one, and
+  // how long the crossfade between two segments is. The search first tries every seek_step-th
+  // position, and then the positions around the best one.
+  std::size_t m_segment_frames = 0;
+  std::size_t m_seek_frames = 0;
+  std::size_t m_overlap_frames = 0;
+  std::size_t m_seek_step = 1;
+
+  double m_tempo = 1.0;
+  // The fractional part of the input frames skipped after each segment
+  double m_skip_fraction = 0.0;
+
+  // Interleaved stereo. The input before m_input_start has been used up, and is only removed
+  // before new input is added, to keep the moves rare.
+  std::vector<float> m_input;
+  std::size_t m_input_start = 0;
+
+  // The end of the previous segment, which the next one is crossfaded with, and a copy weighted
+  // towards its middle that the next segment is compared against
+  std::vector<float> m_overlap;
+  std::vector<float> m_reference;
+
+  std::vector<s16> m_output;
+  std::size_t m_output_start = 0;
+};
+}  // namespace AudioCommon
@@ -4,8 +4,11 @@
 #include "Common/PcapFile.h"
 
 #include <chrono>
+#include <cstring>
+#include <string>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 
 namespace Common
@@ -61,4 +64,31 @@ void PCAP::AddPacket(const u8* bytes, size_t size)
   m_fp->WriteBytes(&rec_hdr, sizeof(rec_hdr));
   m_fp->WriteBytes(bytes, size);
 }
+
+PCAPReader::PCAPReader(const std::string& filename)
+{
+  if (!File::ReadFileToString(filename, m_data) || m_data.size() < sizeof(PCAPHeader))
+    return;
+
+  PCAPHeader hdr;
+  std::memcpy(&hdr, m_data.data(), sizeof(hdr));
+  m_valid = hdr.magic_number == PCAP_MAGIC;
+  m_offset = sizeof(hdr);
+}
+
+std::span<const u8> PCAPReader::NextPacket()
+{
+  if (!m_valid || m_data.size() - m_offset < sizeof(PCAPRecordHeader))
+    return {};
+
+  PCAPRecordHeader rec_hdr;
+  std::memcpy(&rec_hdr, &m_data[m_offset], sizeof(rec_hdr));
+  const std::size_t packet_offset = m_offset + sizeof(rec_hdr);
+  // A truncated last packet is ignored
+  if (m_data.size() - packet_offset < rec_hdr.size_in_file)
+    return {};
+
+  m_offset = packet_offset + rec_hdr.size_in_file;
+  return {reinterpret_cast<const u8*>(&m_data[packet_offset]), rec_hdr.size_in_file};
+}
 }  // namespace Common
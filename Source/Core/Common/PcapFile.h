@@ -5,6 +5,7 @@
 // to any capture of packetized intercommunication data. This file provides a
 // class called PCAP which is a very light wrapper around the file format,
 // allowing only creating a new PCAP capture file and appending packets to it.
+// PCAPReader reads the packets of such a file back.
 //
 // Example use:
 //   PCAP pcap(new IOFile("test.pcap", "wb"));
@@ -14,6 +15,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
+#include <string>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -48,4 +51,23 @@ private:
 
   std::unique_ptr<File::IOFile> m_fp;
 };
+
+// Reads the packets of a PCAP file, which is loaded into memory as a whole.
+class PCAPReader final
+{
+public:
+  explicit PCAPReader(const std::string& filename);
+
+  // False if the file couldn't be read or isn't a PCAP file.
+  bool IsValid() const { return m_valid; }
+
+  // Returns the next packet, or an empty span once all packets have been read. The span stays
+  // valid for the lifetime of the reader.
+  std::span<const u8> NextPacket();
+
+private:
+  std::string m_data;
+  std::size_t m_offset = 0;
+  bool m_valid = false;
+};
 }  // namespace Common
@@ -31,6 +31,7 @@ enum class CPUCore;
 namespace AudioCommon
 {
 enum class DPL2Quality;
+enum class TimeStretchQuality;
 }
 
 namespace ExpansionInterface
@@ -56,6 +57,7 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_FOLLOW_LIKELY_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
@@ -76,6 +78,8 @@ extern const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY;
 extern const Info<int> MAIN_AUDIO_LATENCY;
 extern const Info<int> MAIN_AUDIO_BUFFER_SIZE;
 extern const Info<bool> MAIN_AUDIO_FILL_GAPS;
+extern const Info<bool> MAIN_AUDIO_ADAPTIVE_BUFFER;
+extern const Info<AudioCommon::TimeStretchQuality> MAIN_AUDIO_TIME_STRETCH_QUALITY;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -166,6 +170,7 @@ extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_THREAD;
+extern const Info<bool> MAIN_DSP_HLE_WORKER_THREAD;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
 extern const Info<bool> MAIN_DUMP_AUDIO;
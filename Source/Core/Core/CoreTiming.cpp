@@ -21,6 +21,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -367,6 +368,10 @@ void CoreTimingManager::Advance()
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
 
+  // Code which modifies itself without executing isync afterwards must still see the changes by
+  // the next timeslice. Taking an exception is context synchronizing as well.
+  m_system.GetJitInterface().FlushPendingICacheInvalidations();
+
   // Check for any external exceptions.
   // It's important to do this after processing events otherwise any exceptions will be delayed
   // until the next slice:
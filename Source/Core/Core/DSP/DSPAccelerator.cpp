@@ -4,6 +4,8 @@
 #include "Core/DSP/DSPAccelerator.h"
 
 #include <algorithm>
+#include <array>
+#include <initializer_list>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -234,6 +236,87 @@ u16 Accelerator::ReadSample(const s16* coefs)
   return val;
 }
 
+void Accelerator::ReadSamples(s16* samples, u32 count, const s16* coefs)
+{
+  u32 i = 0;
+  while (i < count)
+  {
+    const u32 run_length = GetADPCMRunLength(count - i);
+    if (run_length == 0)
+    {
+      samples[i++] = static_cast<s16>(ReadSample(coefs));
+      continue;
+    }
+
+    DecodeADPCMRun(&samples[i], run_length, coefs);
+    i += run_length;
+  }
+}
+
+// Returns how many of the next samples are plain 4-bit ADPCM samples from the current frame, for
+// which ReadSample wouldn't have to do anything but decode them. Everything else, like frame
+// headers and reaching the end address, is left to ReadSample.
+u32 Accelerator::GetADPCMRunLength(u32 max_count) const
+{
+  if (m_reads_stopped || m_sample_format.size != FormatSize::Size4Bit ||
+      m_sample_format.decode != FormatDecode::ADPCM || m_sample_format.unk != 0)
+  {
+    return 0;
+  }
+
+  // The address after each of the samples must neither be the start of a frame nor one of the
+  // addresses ReadSample checks against the end address
+  const u32 address = m_current_address;
+  u32 run_length = std::min(max_count, 15 - (address & 15));
+  for (const u32 special_address : {m_end_address - 1, m_end_address, m_end_address + 1})
+  {
+    if (special_address > address)
+      run_length = std::min(run_length, special_address - address - 1);
+  }
+  return run_length;
+}
+
+void Accelerator::DecodeADPCMRun(s16* samples, u32 count, const s16* coefs)
+{
+  const int coef_idx = (m_pred_scale >> 4) & 0x7;
+  const s32 coef1 = coefs[coef_idx * 2 + 0];
+  const s32 coef2 = coefs[coef_idx * 2 + 1];
+  const s32 scale = 1 << (m_pred_scale & 0xF);
+
+  // A run never leaves its frame, so it's at most 8 bytes
+  const u32 address = m_current_address;
+  std::array<u8, 8> bytes;
+  const u32 first_byte = address >> 1;
+  const u32 byte_count = ((address + count - 1) >> 1) - first_byte + 1;
+  for (u32 i = 0; i < byte_count; ++i)
+    bytes[i] = ReadMemory(first_byte + i);
+
+  // Only the prediction depends on the previous samples, so the nibbles are scaled beforehand
+  std::array<s32, 16> deltas;
+  for (u32 i = 0; i < count; ++i)
+  {
+    const u32 nibble_address = address + i;
+    const u8 byte = bytes[(nibble_address >> 1) - first_byte];
+    const s32 nibble = (nibble_address & 1) ? (byte & 0xF) : (byte >> 4);
+    deltas[i] = scale * ((nibble ^ 8) - 8);
+  }
+
+  s32 yn1 = m_yn1;
+  s32 yn2 = m_yn2;
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 val32 = deltas[i] + ((0x400 + coef1 * yn1 + coef2 * yn2) >> 11);
+    const s16 val = static_cast<s16>(std::clamp<s32>(val32, -0x7FFF, 0x7FFF));
+    samples[i] = val;
+    yn2 = yn1;
+    yn1 = val;
+  }
+
+  m_yn1 = static_cast<s16>(yn1);
+  m_yn2 = static_cast<s16>(yn2);
+  m_current_address += count;
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
@@ -16,6 +16,8 @@ public:
   virtual ~Accelerator() = default;
 
   u16 ReadSample(const s16* coefs);
+  // Same as calling ReadSample count times, but ADPCM samples are decoded a frame at a time
+  void ReadSamples(s16* samples, u32 count, const s16* coefs);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadRaw();
   void WriteRaw(u16 value);
@@ -48,6 +50,8 @@ protected:
   virtual u8 ReadMemory(u32 address) = 0;
   virtual void WriteMemory(u32 address, u8 value) = 0;
   u16 GetCurrentSample();
+  u32 GetADPCMRunLength(u32 max_count) const;
+  void DecodeADPCMRun(s16* samples, u32 count, const s16* coefs);
 
   // DSP accelerator registers.
   u32 m_start_address = 0;
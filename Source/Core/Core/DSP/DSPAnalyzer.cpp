@@ -60,6 +60,49 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0, 0},
 };
 
+// Whether addr starts a loop which only waits for the top bit of a mailbox to change, like
+//   LR    $AC0.M, @CMBH      (or LRS)
+//   ANDCF $AC0.M, #0x8000    (or ANDF)
+//   JLNZ  addr               (or any other conditional jump back to addr)
+// Most uCodes have a few of these, which the signatures above don't all cover.
+static bool IsMailboxPollingLoop(const SDSP& dsp, u16 addr)
+{
+  const auto is_mailbox_high = [](u16 address) { return address == 0xfffc || address == 0xfffe; };
+
+  u16 pc = addr;
+  u16 reg;
+  const UDSPInstruction load = dsp.ReadIMEM(pc);
+  if ((load & 0xf800) == 0x2000 && is_mailbox_high(0xff00 | (load & 0xff)))
+  {
+    // LRS $(0x18+D), @M
+    reg = 0x18 + ((load >> 8) & 0x7);
+    pc += 1;
+  }
+  else if ((load & 0xffe0) == 0x00c0 && is_mailbox_high(dsp.ReadIMEM(pc + 1)))
+  {
+    // LR $D, @M
+    reg = load & 0x1f;
+    pc += 2;
+  }
+  else
+  {
+    return false;
+  }
+
+  // ANDCF or ANDF $acD.m, #0x8000
+  const UDSPInstruction test = dsp.ReadIMEM(pc);
+  if (((test & 0xfeff) != 0x02c0 && (test & 0xfeff) != 0x02a0) ||
+      dsp.ReadIMEM(pc + 1) != 0x8000 || reg != DSP_REG_ACM0 + ((test >> 8) & 1))
+  {
+    return false;
+  }
+  pc += 2;
+
+  // Jcc addr, with any condition other than always
+  const UDSPInstruction jump = dsp.ReadIMEM(pc);
+  return (jump & 0xfff0) == 0x0290 && (jump & 0xf) != 0xf && dsp.ReadIMEM(pc + 1) == addr;
+}
+
 Analyzer::Analyzer() = default;
 Analyzer::~Analyzer() = default;
 
@@ -171,5 +214,14 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
       }
     }
   }
+
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    if (IsStartOfInstruction(addr) && !IsIdleSkip(addr) && IsMailboxPollingLoop(dsp, addr))
+    {
+      INFO_LOG_FMT(DSPLLE, "Idle skip location found at {:02x} (mailbox polling loop)", addr);
+      m_code_flags[addr] |= CODE_IDLE_SKIP;
+    }
+  }
 }
 }  // namespace DSP
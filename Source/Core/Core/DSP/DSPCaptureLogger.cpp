@@ -7,6 +7,8 @@
 #include <memory>
 #include <string>
 
+#include <fmt/format.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "Common/PcapFile.h"
@@ -52,6 +54,8 @@ PCAPDSPCaptureLogger::PCAPDSPCaptureLogger(std::unique_ptr<Common::PCAP>&& pcap)
 {
 }
 
+PCAPDSPCaptureLogger::~PCAPDSPCaptureLogger() = default;
+
 void PCAPDSPCaptureLogger::LogIFXAccess(bool read, u16 address, u16 value)
 {
   IFXAccessPacket pkt;
@@ -80,4 +84,127 @@ void PCAPDSPCaptureLogger::LogDMA(u16 control, u32 gc_address, u16 dsp_address,
 
   m_pcap->AddPacket(buffer, sizeof(DMAPacket) + length);
 }
+
+static std::string DescribePacket(std::span<const u8> packet)
+{
+  if (packet.size() == sizeof(IFXAccessPacket) && packet[0] == IFX_ACCESS_PACKET_MAGIC)
+  {
+    IFXAccessPacket pkt;
+    std::memcpy(&pkt, packet.data(), sizeof(pkt));
+    // The fields of packed structures can't be passed by reference
+    return fmt::format("IFX {} {:#06x} = {:#06x}", pkt.is_read ? "read of" : "write to",
+                       u16{pkt.address}, u16{pkt.value});
+  }
+  if (packet.size() >= sizeof(DMAPacket) && packet[0] == DMA_PACKET_MAGIC)
+  {
+    DMAPacket pkt;
+    std::memcpy(&pkt, packet.data(), sizeof(pkt));
+    return fmt::format("DMA {:#06x} between {:#010x} and {:#06x}, {:#x} bytes",
+                       u16{pkt.dma_control}, u32{pkt.gc_address}, u16{pkt.dsp_address},
+                       u16{pkt.length});
+  }
+  return "unknown packet";
+}
+
+PCAPDSPCaptureReplayer::PCAPDSPCaptureReplayer(const std::string& pcap_filename)
+    : m_reader(std::make_unique<Common::PCAPReader>(pcap_filename))
+{
+  m_packet = m_reader->NextPacket();
+}
+
+PCAPDSPCaptureReplayer::~PCAPDSPCaptureReplayer() = default;
+
+bool PCAPDSPCaptureReplayer::IsValid() const
+{
+  return m_reader->IsValid();
+}
+
+bool PCAPDSPCaptureReplayer::IsNextIFXAccess(bool read, u16 address) const
+{
+  if (m_packet.size() != sizeof(IFXAccessPacket) || m_packet[0] != IFX_ACCESS_PACKET_MAGIC)
+    return false;
+
+  IFXAccessPacket pkt;
+  std::memcpy(&pkt, m_packet.data(), sizeof(pkt));
+  return pkt.is_read == read && pkt.address == address;
+}
+
+bool PCAPDSPCaptureReplayer::IsNextDMA(u32 gc_address, u16 length) const
+{
+  if (m_packet.size() < sizeof(DMAPacket) || m_packet[0] != DMA_PACKET_MAGIC)
+    return false;
+
+  DMAPacket pkt;
+  std::memcpy(&pkt, m_packet.data(), sizeof(pkt));
+  return pkt.gc_address == gc_address && pkt.length == length &&
+         m_packet.size() == sizeof(DMAPacket) + length;
+}
+
+void PCAPDSPCaptureReplayer::Advance()
+{
+  m_packet = m_reader->NextPacket();
+  m_position++;
+}
+
+void PCAPDSPCaptureReplayer::Diverge(const std::string& access)
+{
+  m_divergence = fmt::format("packet {}: expected {}, got {}", m_position,
+                             DescribePacket(m_packet), access);
+}
+
+u16 PCAPDSPCaptureReplayer::FilterIFXRead(u16 address, u16 read_value)
+{
+  if (!IsReplaying() || !IsNextIFXAccess(true, address))
+    return read_value;
+
+  IFXAccessPacket pkt;
+  std::memcpy(&pkt, m_packet.data(), sizeof(pkt));
+  return pkt.value;
+}
+
+void PCAPDSPCaptureReplayer::LogIFXRead(u16 address, u16 read_value)
+{
+  if (!IsReplaying())
+    return;
+
+  if (IsNextIFXAccess(true, address))
+    Advance();
+  else
+    Diverge(fmt::format("IFX read of {:#06x}", address));
+}
+
+void PCAPDSPCaptureReplayer::LogIFXWrite(u16 address, u16 written_value)
+{
+  if (!IsReplaying())
+    return;
+
+  IFXAccessPacket pkt{IFX_ACCESS_PACKET_MAGIC, 0, address, written_value};
+  if (m_packet.size() == sizeof(pkt) && std::memcmp(m_packet.data(), &pkt, sizeof(pkt)) == 0)
+    Advance();
+  else
+    Diverge(fmt::format("IFX write to {:#06x} = {:#06x}", address, written_value));
+}
+
+void PCAPDSPCaptureReplayer::FilterDMAToDSP(u16* dst, u32 gc_address, u32 length)
+{
+  // Mismatches are reported when the DMA is logged
+  if (IsReplaying() && IsNextDMA(gc_address, static_cast<u16>(length)))
+    std::memcpy(dst, &m_packet[sizeof(DMAPacket)], length);
+}
+
+void PCAPDSPCaptureReplayer::LogDMA(u16 control, u32 gc_address, u16 dsp_address, u16 length,
+                                    const u8* data)
+{
+  if (!IsReplaying())
+    return;
+
+  DMAPacket pkt{DMA_PACKET_MAGIC, control, gc_address, dsp_address, length};
+  const std::span<const u8> header(reinterpret_cast<const u8*>(&pkt), sizeof(pkt));
+  if (!IsNextDMA(gc_address, length) || std::memcmp(m_packet.data(), &pkt, sizeof(pkt)) != 0)
+    Diverge(DescribePacket(header));
+  else if (std::memcmp(&m_packet[sizeof(pkt)], data, length) != 0)
+    Diverge(DescribePacket(header) + " with different data");
+  else
+    Advance();
+}
 }  // namespace DSP
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -11,6 +12,7 @@
 namespace Common
 {
 class PCAP;
+class PCAPReader;
 }
 
 namespace DSP
@@ -29,6 +31,15 @@ public:
   virtual void LogIFXRead(u16 address, u16 read_value) = 0;
   virtual void LogIFXWrite(u16 address, u16 written_value) = 0;
 
+  // Called for IFX reads before they are logged, with the value read from the
+  // hardware. Only a replay of a capture returns something else than that
+  // value.
+  virtual u16 FilterIFXRead(u16 address, u16 read_value) { return read_value; }
+
+  // Called for DMAs to the DSP after the host has copied the data from main
+  // memory. Only a replay of a capture replaces it. Length is in bytes.
+  virtual void FilterDMAToDSP(u16* dst, u32 gc_address, u32 length) {}
+
   // DMAs to/from main memory from/to DSP memory. We let the interpretation
   // of the "control" field to the layer that analyze the logs and do not
   // perform our own interpretation of it. Thus there is only one call which
@@ -60,6 +71,7 @@ public:
   // Takes ownership of pcap.
   PCAPDSPCaptureLogger(Common::PCAP* pcap);
   PCAPDSPCaptureLogger(std::unique_ptr<Common::PCAP>&& pcap);
+  ~PCAPDSPCaptureLogger() override;
 
   void LogIFXRead(u16 address, u16 read_value) override { LogIFXAccess(true, address, read_value); }
   void LogIFXWrite(u16 address, u16 written_value) override
@@ -73,4 +85,44 @@ private:
 
   std::unique_ptr<Common::PCAP> m_pcap;
 };
+
+// Replays a capture written by PCAPDSPCaptureLogger. IFX reads return the
+// values from the capture and DMAs to the DSP copy the data from the capture,
+// so the DSP sees the same inputs as when the capture was recorded. IFX writes
+// and DMAs are checked against the capture, and the replay stops at the first
+// access that doesn't match.
+class PCAPDSPCaptureReplayer final : public DSPCaptureLogger
+{
+public:
+  explicit PCAPDSPCaptureReplayer(const std::string& pcap_filename);
+  ~PCAPDSPCaptureReplayer() override;
+
+  // False if the capture couldn't be read.
+  bool IsValid() const;
+  // True once every packet of the capture has been replayed.
+  bool IsFinished() const { return m_packet.empty(); }
+  bool HasDiverged() const { return !m_divergence.empty(); }
+  // Describes the first access that didn't match the capture.
+  const std::string& GetDivergence() const { return m_divergence; }
+  // Number of packets replayed so far.
+  u64 GetPosition() const { return m_position; }
+
+  u16 FilterIFXRead(u16 address, u16 read_value) override;
+  void FilterDMAToDSP(u16* dst, u32 gc_address, u32 length) override;
+  void LogIFXRead(u16 address, u16 read_value) override;
+  void LogIFXWrite(u16 address, u16 written_value) override;
+  void LogDMA(u16 control, u32 gc_address, u16 dsp_address, u16 length, const u8* data) override;
+
+private:
+  bool IsReplaying() const { return !IsFinished() && !HasDiverged(); }
+  bool IsNextIFXAccess(bool read, u16 address) const;
+  bool IsNextDMA(u32 gc_address, u16 length) const;
+  void Advance();
+  void Diverge(const std::string& access);
+
+  std::unique_ptr<Common::PCAPReader> m_reader;
+  std::span<const u8> m_packet;
+  u64 m_position = 0;
+  std::string m_divergence;
+};
 }  // namespace DSP
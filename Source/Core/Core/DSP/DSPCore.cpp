@@ -20,6 +20,7 @@
 #include "Core/DSP/DSPAnalyzer.h"
 #include "Core/DSP/DSPHost.h"
 #include "Core/DSP/Interpreter/DSPInterpreter.h"
+#include "Core/DSP/Jit/CachedInterpreter/DSPCachedInterpreter.h"
 #include "Core/DSP/Jit/DSPEmitterBase.h"
 
 namespace DSP
@@ -434,6 +435,8 @@ bool DSPCore::Initialize(const DSPInitOptions& opts)
   // Initialize JIT, if necessary
   if (opts.core_type == DSPInitOptions::CoreType::JIT64)
     m_dsp_jit = JIT::CreateDSPEmitter(*this);
+  else if (opts.core_type == DSPInitOptions::CoreType::CachedInterpreter)
+    m_dsp_jit = std::make_unique<JIT::CachedInterpreter>(*this);
 
   m_dsp_cap.reset(opts.capture_logger);
 
@@ -579,6 +582,16 @@ void DSPCore::WriteMailboxHigh(Mailbox mailbox, u16 value)
   m_dsp.WriteMailboxHigh(mailbox, value);
 }
 
+u16 DSPCore::FilterIFXRead(u16 address, u16 read_value)
+{
+  return m_dsp_cap->FilterIFXRead(address, read_value);
+}
+
+void DSPCore::FilterDMAToDSP(u16* dst, u32 gc_address, u32 length)
+{
+  m_dsp_cap->FilterDMAToDSP(dst, gc_address, length);
+}
+
 void DSPCore::LogIFXRead(u16 address, u16 read_value)
 {
   m_dsp_cap->LogIFXRead(address, read_value);
@@ -298,6 +298,7 @@ struct DSPInitOptions
   {
     Interpreter,
     JIT64,
+    CachedInterpreter,
   };
   CoreType core_type = CoreType::JIT64;
 
@@ -553,6 +554,12 @@ public:
   // Writes to the high part of the mailbox register.
   void WriteMailboxHigh(Mailbox mailbox, u16 value);
 
+  // Lets the capture logger replace the value of an IFX register read.
+  u16 FilterIFXRead(u16 address, u16 read_value);
+
+  // Lets the capture logger replace the data of a DMA to the DSP.
+  void FilterDMAToDSP(u16* dst, u32 gc_address, u32 length);
+
   // Logs an IFX register read.
   void LogIFXRead(u16 address, u16 read_value);
 
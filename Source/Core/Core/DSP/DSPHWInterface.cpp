@@ -275,7 +275,7 @@ u16 SDSP::ReadIFXImpl(u16 address)
 
 u16 SDSP::ReadIFX(u16 address)
 {
-  const u16 retval = ReadIFXImpl(address);
+  const u16 retval = m_dsp_core.FilterIFXRead(address, ReadIFXImpl(address));
   m_dsp_core.LogIFXRead(address, retval);
   return retval;
 }
@@ -284,6 +284,7 @@ const u8* SDSP::IDMAIn(u16 dsp_addr, u32 addr, u32 size)
 {
   Common::UnWriteProtectMemory(iram, DSP_IRAM_BYTE_SIZE, false);
   Host::DMAToDSP(iram + dsp_addr / 2, addr, size);
+  m_dsp_core.FilterDMAToDSP(iram + dsp_addr / 2, addr, size);
   Common::WriteProtectMemory(iram, DSP_IRAM_BYTE_SIZE, false);
 
   Host::CodeLoaded(m_dsp_core, addr, size);
@@ -304,6 +305,7 @@ const u8* SDSP::IDMAOut(u16 dsp_addr, u32 addr, u32 size)
 const u8* SDSP::DDMAIn(u16 dsp_addr, u32 addr, u32 size)
 {
   Host::DMAToDSP(dram + dsp_addr / 2, addr, size);
+  m_dsp_core.FilterDMAToDSP(dram + dsp_addr / 2, addr, size);
   DEBUG_LOG_FMT(DSPLLE, "*** ddma_in RAM ({:#010x}) -> DRAM_DSP ({:#06x}) : size ({:#010x})", addr,
                 dsp_addr / 2, size);
 
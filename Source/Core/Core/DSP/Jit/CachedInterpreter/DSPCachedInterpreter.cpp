@@ -0,0 +1,176 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/CachedInterpreter/DSPCachedInterpreter.h"
+
+#include <algorithm>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+namespace DSP::JIT
+{
+constexpr u16 MAX_BLOCK_SIZE = 250;
+constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+CachedInterpreter::CachedInterpreter(DSPCore& dsp) : m_blocks(MAX_BLOCKS), m_dsp_core{dsp}
+{
+  Interpreter::InitInstructionTables();
+}
+
+CachedInterpreter::~CachedInterpreter() = default;
+
+u16 CachedInterpreter::RunCycles(u16 cycles)
+{
+  SDSP& state = m_dsp_core.DSPState();
+
+  if (state.external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+  {
+    m_dsp_core.CheckExternalInterrupt();
+    m_dsp_core.CheckExceptions();
+  }
+
+  m_cycles_left = cycles;
+  while (m_cycles_left > 0)
+  {
+    if (Host::OnThread() && state.external_interrupt_waiting.load(std::memory_order_relaxed))
+      break;
+    if ((state.control_reg & CR_HALT) != 0)
+      break;
+
+    if (m_blocks[state.pc].size == 0)
+      Compile(state.pc);
+
+    const u16 executed = ExecuteBlock(m_blocks[state.pc]);
+    m_cycles_left -= std::min(executed, m_cycles_left);
+  }
+
+  if (state.reset_dspjit_codespace)
+    ClearCode();
+
+  return m_cycles_left;
+}
+
+void CachedInterpreter::ClearIRAM()
+{
+  std::fill_n(m_blocks.begin(), DSP_IRAM_SIZE, Block{});
+  // The instructions are only thrown away once RunCycles is done with them, as this can be called
+  // in the middle of a block
+  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+}
+
+void CachedInterpreter::ClearCode()
+{
+  m_code.clear();
+  std::ranges::fill(m_blocks, Block{});
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+void CachedInterpreter::DoState(PointerWrap& p)
+{
+  p.Do(m_cycles_left);
+}
+
+void CachedInterpreter::Compile(u16 start_addr)
+{
+  const SDSP& state = m_dsp_core.DSPState();
+  const Analyzer& analyzer = state.GetAnalyzer();
+
+  Block& block = m_blocks[start_addr];
+  block.offset = static_cast<u32>(m_code.size());
+  block.idle_skip = !Host::OnThread() && analyzer.IsIdleSkip(start_addr);
+
+  u16 address = start_addr;
+  u16 size = 0;
+  while (size < MAX_BLOCK_SIZE)
+  {
+    const UDSPInstruction inst = state.ReadIMEM(address);
+    const DSPOPCTemplate* const opcode = GetOpTemplate(inst);
+    const u16 next_address = static_cast<u16>(address + opcode->size);
+
+    m_code.push_back({
+        .op = Interpreter::GetOp(inst),
+        .ext_op = opcode->extended ? Interpreter::GetExtOp(inst) : nullptr,
+        .inst = inst,
+        .address = address,
+        .next_address = next_address,
+        .check_exceptions = analyzer.IsCheckExceptions(address),
+        .loop_end = analyzer.IsLoopEnd(static_cast<u16>(next_address - 1)),
+    });
+    size++;
+    address = next_address;
+
+    if (opcode->uncond_branch)
+      break;
+
+    // End the block if we're before an idle skip address
+    if (analyzer.IsIdleSkip(address))
+      break;
+  }
+
+  block.size = size;
+}
+
+// Returns the number of cycles the block took. The block is left as soon as an instruction doesn't
+// continue at the next one, be it because of a branch, a skipped instruction, a halt or the end of
+// a loop, so only the instructions which are always in sequence are cached together.
+u16 CachedInterpreter::ExecuteBlock(Block block)
+{
+  SDSP& state = m_dsp_core.DSPState();
+  Interpreter::Interpreter& interpreter = m_dsp_core.GetInterpreter();
+  const Instruction* const instructions = &m_code[block.offset];
+
+  const auto exit_block = [block](u16 executed) {
+    return block.idle_skip ? DSP_IDLE_SKIP_CYCLES : executed;
+  };
+
+  for (u16 i = 0; i < block.size; i++)
+  {
+    const Instruction& instruction = instructions[i];
+
+    if (instruction.check_exceptions)
+    {
+      state.pc = instruction.address;
+      if (m_dsp_core.CheckExceptions())
+        return i;
+    }
+
+    // Like FetchInstruction, which instructions with an immediate rely on to fetch the next word
+    state.pc = static_cast<u16>(instruction.address + 1);
+
+    if (instruction.ext_op != nullptr)
+    {
+      (interpreter.*instruction.ext_op)(instruction.inst);
+      (interpreter.*instruction.op)(instruction.inst);
+      interpreter.ApplyWriteBackLog();
+    }
+    else
+    {
+      (interpreter.*instruction.op)(instruction.inst);
+    }
+
+    if (state.pc != instruction.next_address)
+    {
+      // As in Interpreter::Step, the loop end is looked up where execution continues
+      if (state.GetAnalyzer().IsLoopEnd(static_cast<u16>(state.pc - 1)))
+        interpreter.HandleLoop();
+      return exit_block(i + 1);
+    }
+
+    if (instruction.loop_end)
+    {
+      interpreter.HandleLoop();
+      if (state.pc != instruction.next_address)
+        return exit_block(i + 1);
+    }
+  }
+
+  return exit_block(block.size);
+}
+}  // namespace DSP::JIT
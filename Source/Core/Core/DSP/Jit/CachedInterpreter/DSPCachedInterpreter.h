@@ -0,0 +1,74 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP::JIT
+{
+// Recompiler backend for hosts without a native DSP JIT. Blocks are split up the same way as the
+// x64 recompiler does it, but instead of machine code, each block is a list of already decoded
+// interpreter functions. This saves the instruction fetch, the opcode table lookups and the
+// analyzer lookups the interpreter does for every instruction it runs.
+class CachedInterpreter final : public DSPEmitter
+{
+public:
+  explicit CachedInterpreter(DSPCore& dsp);
+  ~CachedInterpreter() override;
+
+  CachedInterpreter(const CachedInterpreter&) = delete;
+  CachedInterpreter& operator=(const CachedInterpreter&) = delete;
+  CachedInterpreter(CachedInterpreter&&) = delete;
+  CachedInterpreter& operator=(CachedInterpreter&&) = delete;
+
+  u16 RunCycles(u16 cycles) override;
+  void ClearIRAM() override;
+
+  void DoState(PointerWrap& p) override;
+
+private:
+  struct Instruction
+  {
+    Interpreter::InterpreterFunction op;
+    // nullptr if the instruction has no extended opcode
+    Interpreter::InterpreterFunction ext_op;
+    UDSPInstruction inst;
+    u16 address;
+    u16 next_address;
+    bool check_exceptions;
+    bool loop_end;
+  };
+
+  struct Block
+  {
+    u32 offset = 0;
+    // 0 if the block hasn't been compiled yet
+    u16 size = 0;
+    bool idle_skip = false;
+  };
+
+  void Compile(u16 start_addr);
+  // Takes a copy, as the instructions can clear m_blocks while the block runs
+  u16 ExecuteBlock(Block block);
+  void ClearCode();
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+
+  std::vector<Instruction> m_code;
+  std::vector<Block> m_blocks;
+
+  u16 m_cycles_left = 0;
+
+  DSPCore& m_dsp_core;
+};
+}  // namespace DSP::JIT
@@ -5,18 +5,21 @@
 
 #if defined(_M_X86_64)
 #include "Core/DSP/Jit/x64/DSPEmitter.h"
+#else
+#include "Core/DSP/Jit/CachedInterpreter/DSPCachedInterpreter.h"
 #endif
 
 namespace DSP::JIT
 {
 DSPEmitter::~DSPEmitter() = default;
 
-std::unique_ptr<DSPEmitter> CreateDSPEmitter([[maybe_unused]] DSPCore& dsp)
+std::unique_ptr<DSPEmitter> CreateDSPEmitter(DSPCore& dsp)
 {
 #if defined(_M_X86_64)
   return std::make_unique<x64::DSPEmitter>(dsp);
 #else
-  return std::make_unique<DSPEmitterNull>();
+  // There is no native recompiler for any other host, ARM64 included
+  return std::make_unique<CachedInterpreter>(dsp);
 #endif
 }
 }  // namespace DSP::JIT
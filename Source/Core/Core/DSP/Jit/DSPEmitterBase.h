@@ -27,13 +27,5 @@ public:
   virtual void DoState(PointerWrap& p) = 0;
 };
 
-class DSPEmitterNull final : public DSPEmitter
-{
-public:
-  u16 RunCycles(u16) override { return 0; }
-  void ClearIRAM() override {}
-  void DoState(PointerWrap&) override {}
-};
-
 std::unique_ptr<DSPEmitter> CreateDSPEmitter(DSPCore& dsp);
 }  // namespace DSP::JIT
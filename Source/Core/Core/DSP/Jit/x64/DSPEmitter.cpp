@@ -284,16 +284,7 @@ void DSPEmitter::Compile(u16 start_addr)
       // end of each block and in this order
       DSPJitRegCache c(m_gpr);
       HandleLoop();
-      m_gpr.SaveRegs();
-      if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-      {
-        MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-      }
-      else
-      {
-        MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-      }
-      JMP(m_return_dispatcher, Jump::Near);
+      WriteBlockExit(!Host::OnThread() && analyzer.IsIdleSkip(start_addr));
       m_gpr.LoadRegs(false);
       m_gpr.FlushRegs(c, false);
 
@@ -320,16 +311,7 @@ void DSPEmitter::Compile(u16 start_addr)
 
         DSPJitRegCache c(m_gpr);
         // don't update g_dsp.pc -- the branch insn already did
-        m_gpr.SaveRegs();
-        if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-        {
-          MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-        }
-        else
-        {
-          MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-        }
-        JMP(m_return_dispatcher, Jump::Near);
+        WriteBlockExit(!Host::OnThread() && analyzer.IsIdleSkip(start_addr));
         m_gpr.LoadRegs(false);
         m_gpr.FlushRegs(c, false);
 
@@ -383,15 +365,59 @@ void DSPEmitter::Compile(u16 start_addr)
     m_block_size[start_addr] = 1;
   }
 
-  m_gpr.SaveRegs();
-  if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
+  WriteBlockExit(!Host::OnThread() && analyzer.IsIdleSkip(start_addr));
+}
+
+// Leaves the block, with the new PC already stored. Unless this is an idle skip, which has to give
+// up the rest of the time slice, the next block is entered directly if it has been compiled and
+// enough cycles are left to run it. Its link entry expects the registers to be cached the way
+// FlushRegs leaves them, so nothing needs to be saved to and reloaded from SDSP in between.
+void DSPEmitter::WriteBlockExit(bool idle_skip)
+{
+  if (idle_skip)
   {
+    m_gpr.SaveRegs();
     MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
+    JMP(m_return_dispatcher, Jump::Near);
+    return;
   }
-  else
+
+  const u16 block_size = m_block_size[m_start_address];
+  m_gpr.FlushRegs();
+
+  // The same checks as the dispatcher loop
+  TEST(8, M_SDSP_control_reg(), Imm8(CR_HALT));
+  FixupBranch halted = J_CC(CC_NZ, Jump::Near);
+  FixupBranch interrupt_waiting;
+  if (Host::OnThread())
   {
-    MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
+    CMP(8, M_SDSP_external_interrupt_waiting(), Imm8(0));
+    interrupt_waiting = J_CC(CC_NE, Jump::Near);
   }
+
+  // RAX, RCX and RDX are never used to cache guest registers
+  MOVZX(64, 16, RCX, M_SDSP_pc());
+  MOV(64, R(RAX), ImmPtr(m_block_links.data()));
+  MOV(64, R(RAX), MComplex(RAX, RCX, SCALE_8, 0));
+  TEST(64, R(RAX), R(RAX));
+  FixupBranch not_linkable = J_CC(CC_Z, Jump::Near);
+
+  MOV(64, R(RDX), ImmPtr(m_block_size.data()));
+  MOVZX(32, 16, EDX, MComplex(RDX, RCX, SCALE_2, 0));
+  ADD(32, R(EDX), Imm32(block_size));
+  MOV(64, R(RCX), ImmPtr(&m_cycles_left));
+  CMP(16, MatR(RCX), R(DX));
+  FixupBranch not_enough_cycles = J_CC(CC_BE, Jump::Near);
+  SUB(16, MatR(RCX), Imm16(block_size));
+  JMPptr(R(RAX));
+
+  SetJumpTarget(halted);
+  if (Host::OnThread())
+    SetJumpTarget(interrupt_waiting);
+  SetJumpTarget(not_linkable);
+  SetJumpTarget(not_enough_cycles);
+  m_gpr.SaveRegs();
+  MOV(16, R(EAX), Imm16(block_size));
   JMP(m_return_dispatcher, Jump::Near);
 }
 
@@ -212,6 +212,7 @@ private:
   void FallBackToInterpreter(UDSPInstruction inst);
 
   void WriteBranchExit();
+  void WriteBlockExit(bool idle_skip);
   void WriteBlockLink(u16 dest);
 
   void ReJitConditional(UDSPInstruction opc, void (DSPEmitter::*conditional_fn)(UDSPInstruction));
@@ -0,0 +1,220 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/GuestProfiler.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/ChunkFile.h"
+#include "Common/SymbolDB.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace Core
+{
+static std::string GetFunctionName(const Common::SymbolDB& symbol_db, u32 address)
+{
+  const Common::Symbol* const symbol = symbol_db.GetSymbolFromAddr(address);
+  if (symbol == nullptr || symbol->name.empty())
+    return fmt::format("{:08x}", address);
+
+  // Semicolons separate the frames of a collapsed stack
+  std::string name = symbol->name;
+  std::ranges::replace(name, ';', ':');
+  return name;
+}
+
+GuestProfiler::GuestProfiler(System& system) : m_system(system)
+{
+}
+
+void GuestProfiler::Init()
+{
+  m_event = m_system.GetCoreTiming().RegisterEvent("GuestProfilerSample", SampleCallback);
+  m_running = false;
+}
+
+void GuestProfiler::DoState(PointerWrap& p)
+{
+  // Whether the profiler runs isn't part of a savestate, but its sample event is. So after loading
+  // one, the event is scheduled again if profiling and dropped otherwise.
+  if (!p.IsReadMode())
+    return;
+
+  auto& core_timing = m_system.GetCoreTiming();
+  core_timing.RemoveEvent(m_event);
+  if (m_running)
+  {
+    m_last_sample_ticks = core_timing.GetTicks();
+    core_timing.ScheduleEvent(m_interval, m_event);
+  }
+}
+
+void GuestProfiler::Start(const CPUThreadGuard&, u32 sample_rate)
+{
+  if (m_running)
+    return;
+
+  auto& core_timing = m_system.GetCoreTiming();
+  m_interval =
+      std::max<u64>(m_system.GetSystemTimers().GetTicksPerSecond() / std::max(sample_rate, 1u), 1);
+  m_last_sample_ticks = core_timing.GetTicks();
+  m_running = true;
+  core_timing.ScheduleEvent(m_interval, m_event);
+}
+
+void GuestProfiler::Stop(const CPUThreadGuard&)
+{
+  if (!m_running)
+    return;
+
+  m_running = false;
+  m_system.GetCoreTiming().RemoveEvent(m_event);
+}
+
+void GuestProfiler::SampleCallback(System& system, u64 userdata, s64 cycles_late)
+{
+  GuestProfiler& profiler = system.GetPowerPC().GetGuestProfiler();
+  profiler.TakeSample(CPUThreadGuard{system});
+  system.GetCoreTiming().ScheduleEvent(profiler.m_interval - cycles_late, profiler.m_event);
+}
+
+void GuestProfiler::TakeSample(const CPUThreadGuard& guard)
+{
+  const PowerPC::PowerPCState& ppc_state = m_system.GetPPCState();
+
+  const u64 ticks = m_system.GetCoreTiming().GetTicks();
+  const u64 cycles = ticks - std::exchange(m_last_sample_ticks, ticks);
+
+  // Leaf functions don't store LR in the back chain, so the caller has to be taken from LR. For
+  // any other function, LR points either into the function itself or into its caller, which the
+  // back chain also reports; both are merged away by AddSample.
+  m_frames.clear();
+  m_frames.push_back(ppc_state.pc);
+  if (LR(ppc_state) != 0)
+    m_frames.push_back(LR(ppc_state) - 4);
+
+  if (PowerPC::MMU::HostIsRAMAddress(guard, ppc_state.gpr[1]))
+  {
+    u32 frame = PowerPC::MMU::HostRead_U32(guard, ppc_state.gpr[1]);
+    while (m_frames.size() < MAX_STACK_DEPTH && frame != 0 &&
+           PowerPC::MMU::HostIsRAMAddress(guard, frame + 4))
+    {
+      const u32 return_address = PowerPC::MMU::HostRead_U32(guard, frame + 4);
+      if (return_address == 0)
+        break;
+      m_frames.push_back(return_address - 4);
+
+      // The stack grows downwards, so anything else is a corrupt or looping back chain
+      const u32 next_frame = PowerPC::MMU::HostRead_U32(guard, frame);
+      if (next_frame <= frame)
+        break;
+      frame = next_frame;
+    }
+  }
+
+  AddSample(m_system.GetPowerPC().GetSymbolDB(), m_frames, cycles);
+}
+
+void GuestProfiler::AddSample(const Common::SymbolDB& symbol_db, std::span<const u32> frames,
+                              u64 cycles)
+{
+  Stack stack;
+  stack.reserve(frames.size());
+  for (const u32 address : frames)
+  {
+    const Common::Symbol* const symbol = symbol_db.GetSymbolFromAddr(address);
+    const u32 function = symbol != nullptr ? symbol->address : address;
+    if (stack.empty() || stack.back() != function)
+      stack.push_back(function);
+  }
+
+  if (stack.empty())
+    return;
+
+  StackValue& value = m_stacks[std::move(stack)];
+  value.samples++;
+  value.cycles += cycles;
+}
+
+GuestProfiler::StackValue GuestProfiler::GetTotal() const
+{
+  StackValue total;
+  for (const auto& [stack, value] : m_stacks)
+  {
+    total.samples += value.samples;
+    total.cycles += value.cycles;
+  }
+  return total;
+}
+
+void GuestProfiler::WriteCollapsedStacks(const Common::SymbolDB& symbol_db, std::FILE* file) const
+{
+  for (const auto& [stack, value] : m_stacks)
+  {
+    std::string line;
+    for (auto it = stack.rbegin(); it != stack.rend(); ++it)
+    {
+      if (it != stack.rbegin())
+        line += ';';
+      line += GetFunctionName(symbol_db, *it);
+    }
+    fmt::println(file, "{} {}", line, value.cycles);
+  }
+}
+
+void GuestProfiler::WriteFunctionReport(const Common::SymbolDB& symbol_db, std::FILE* file) const
+{
+  struct FunctionValue
+  {
+    StackValue self;
+    StackValue total;
+  };
+  std::map<u32, FunctionValue> functions;
+
+  for (const auto& [stack, value] : m_stacks)
+  {
+    FunctionValue& leaf = functions[stack.front()];
+    leaf.self.samples += value.samples;
+    leaf.self.cycles += value.cycles;
+
+    // Recursive functions appear several times in a stack, but only count once towards the total
+    for (auto it = stack.begin(); it != stack.end(); ++it)
+    {
+      if (std::find(stack.begin(), it, *it) != it)
+        continue;
+      FunctionValue& function = functions[*it];
+      function.total.samples += value.samples;
+      function.total.cycles += value.cycles;
+    }
+  }
+
+  std::vector<std::pair<u32, FunctionValue>> sorted(functions.begin(), functions.end());
+  std::ranges::stable_sort(sorted, std::ranges::greater{},
+                           [](const auto& entry) { return entry.second.self.cycles; });
+
+  const u64 overall_cycles = GetTotal().cycles;
+  const auto percent = [overall_cycles](u64 cycles) {
+    return overall_cycles == 0 ? double{} : 100.0 * cycles / overall_cycles;
+  };
+
+  std::fputs("address\tselfCycles\tselfPercent\tselfSamples\ttotalCycles\ttotalPercent"
+             "\ttotalSamples\tsymbol\n",
+             file);
+  for (const auto& [address, function] : sorted)
+  {
+    fmt::println(file, "{:08x}\t{}\t{:.6f}\t{}\t{}\t{:.6f}\t{}\t\"{}\"", address,
+                 function.self.cycles, percent(function.self.cycles), function.self.samples,
+                 function.total.cycles, percent(function.total.cycles), function.total.samples,
+                 GetFunctionName(symbol_db, address));
+  }
+}
+}  // namespace Core
@@ -0,0 +1,96 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <map>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class PointerWrap;
+
+namespace Common
+{
+class SymbolDB;
+}
+namespace CoreTiming
+{
+struct EventType;
+}
+
+namespace Core
+{
+class CPUThreadGuard;
+class System;
+
+// Statistical profiler for guest code. While running, a CoreTiming event periodically samples the
+// PC, LR and the stack back chain, and charges the emulated cycles elapsed since the previous
+// sample to the functions found there. It works the same with every CPU core, and costs nothing
+// while stopped.
+//
+// Samples are taken between blocks, so attribution is only as fine-grained as a block. The
+// extra event shortens some timing slices, so don't profile during netplay or movie playback.
+class GuestProfiler
+{
+public:
+  // Samples per emulated second
+  static constexpr u32 DEFAULT_SAMPLE_RATE = 1000;
+  static constexpr std::size_t MAX_STACK_DEPTH = 32;
+
+  struct StackValue
+  {
+    u64 samples = 0;
+    u64 cycles = 0;
+  };
+
+  // Functions are identified by their start address. Stacks are ordered innermost function first.
+  using Stack = std::vector<u32>;
+  using StackMap = std::map<Stack, StackValue>;
+
+  explicit GuestProfiler(System& system);
+  GuestProfiler(const GuestProfiler&) = delete;
+  GuestProfiler(GuestProfiler&&) = delete;
+  GuestProfiler& operator=(const GuestProfiler&) = delete;
+  GuestProfiler& operator=(GuestProfiler&&) = delete;
+
+  void Init();
+  void DoState(PointerWrap& p);
+
+  void Start(const CPUThreadGuard& guard, u32 sample_rate = DEFAULT_SAMPLE_RATE);
+  void Stop(const CPUThreadGuard& guard);
+  bool IsRunning() const { return m_running; }
+  void Clear() { m_stacks.clear(); }
+
+  // Frames are guest addresses, innermost first. Each is replaced by the start of the function it
+  // belongs to, and consecutive frames in the same function are merged.
+  void AddSample(const Common::SymbolDB& symbol_db, std::span<const u32> frames, u64 cycles);
+
+  const StackMap& GetStacks() const { return m_stacks; }
+  StackValue GetTotal() const;
+
+  // One line per distinct stack in the "collapsed" format read by flamegraph.pl, inferno and
+  // speedscope, weighted by emulated cycles.
+  void WriteCollapsedStacks(const Common::SymbolDB& symbol_db, std::FILE* file) const;
+  // Tab separated table of the cycles spent in each function (self) and in everything it
+  // called (total), sorted by self cycles.
+  void WriteFunctionReport(const Common::SymbolDB& symbol_db, std::FILE* file) const;
+
+private:
+  static void SampleCallback(System& system, u64 userdata, s64 cycles_late);
+  void TakeSample(const CPUThreadGuard& guard);
+
+  System& m_system;
+  CoreTiming::EventType* m_event = nullptr;
+
+  bool m_running = false;
+  u64 m_interval = 0;
+  u64 m_last_sample_ticks = 0;
+
+  StackMap m_stacks;
+  std::vector<u32> m_frames;
+};
+}  // namespace Core
@@ -6,6 +6,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -22,6 +23,15 @@ DSPHLE::~DSPHLE() = default;
 
 bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 {
+  FinishWorkerThreadWork();
+
+  m_has_worker_thread =
+      Config::Get(Config::MAIN_DSP_HLE_WORKER_THREAD) && !Core::WantsDeterminism();
+  if (m_has_worker_thread)
+    m_worker_thread.Reset("DSP HLE worker");
+  else
+    m_worker_thread.Shutdown();
+
   m_wii = wii;
   m_ucode = nullptr;
   m_last_ucode = nullptr;
@@ -44,11 +54,23 @@ void DSPHLE::DSP_StopSoundStream()
 
 void DSPHLE::Shutdown()
 {
+  FinishWorkerThreadWork();
+  m_worker_thread.Shutdown();
+  m_has_worker_thread = false;
+
   m_ucode = nullptr;
 }
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  FinishWorkerThreadWork();
+
+  if (m_has_worker_thread && Core::WantsDeterminism())
+  {
+    m_worker_thread.Shutdown();
+    m_has_worker_thread = false;
+  }
+
   if (m_ucode != nullptr)
     m_ucode->Update();
 }
@@ -57,11 +79,39 @@ u32 DSPHLE::DSP_UpdateRate()
 {
   // AX HLE uses 3ms (Wii) or 5ms (GC) timing period
   // But to be sure, just update the HLE every ms.
-  return m_system.GetSystemTimers().GetTicksPerSecond() / 1000;
+  // The worker thread's results are delivered on update, so update more often to keep its latency
+  // within what DSP LLE shows for command lists.
+  const u32 updates_per_second = m_has_worker_thread ? 4000 : 1000;
+  return m_system.GetSystemTimers().GetTicksPerSecond() / updates_per_second;
+}
+
+void DSPHLE::RunOnWorkerThread(std::function<void()> work)
+{
+  m_mail_handler.HoldMails();
+  m_worker_thread_work_pending = true;
+  m_worker_thread.Push(std::move(work));
+}
+
+void DSPHLE::WaitForWorkerThread()
+{
+  if (m_worker_thread_work_pending)
+    m_worker_thread.WaitForCompletion();
+}
+
+void DSPHLE::FinishWorkerThreadWork()
+{
+  if (!m_worker_thread_work_pending)
+    return;
+
+  m_worker_thread.WaitForCompletion();
+  m_worker_thread_work_pending = false;
+  m_mail_handler.ReleaseMails();
 }
 
 void DSPHLE::SendMailToDSP(u32 mail)
 {
+  WaitForWorkerThread();
+
   if (m_ucode != nullptr)
   {
     DEBUG_LOG_FMT(DSP_MAIL, "CPU writes {:#010x}", mail);
@@ -98,6 +148,9 @@ void DSPHLE::SwapUCode(u32 crc)
 
 void DSPHLE::DoState(PointerWrap& p)
 {
+  // Savestates don't keep track of held mails, so deliver them early
+  FinishWorkerThreadWork();
+
   bool is_hle = true;
   p.Do(is_hle);
   if (!is_hle && p.IsReadMode())
@@ -194,6 +247,9 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 // Other DSP functions
 u16 DSPHLE::DSP_WriteControlRegister(u16 value)
 {
+  // This may reset the uCode
+  WaitForWorkerThread();
+
   DSP::UDSPControl temp(value);
 
   if (m_dsp_control.DSPHalt != temp.DSPHalt)
@@ -244,5 +300,8 @@ u16 DSPHLE::DSP_ReadControlRegister()
 
 void DSPHLE::PauseAndLock(bool do_lock)
 {
+  // Whoever paused the emulation may look at or save memory the worker thread writes to
+  if (do_lock)
+    WaitForWorkerThread();
 }
 }  // namespace DSP::HLE
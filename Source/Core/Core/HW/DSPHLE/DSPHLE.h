@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/DSPEmulator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -52,9 +54,21 @@ public:
 
   Core::System& GetSystem() const { return m_system; }
 
+  // With the worker thread, uCode work runs in parallel with the emulated CPU. The mails it pushes
+  // are held back until the next DSP_Update, so when the CPU gets to see the results only depends
+  // on emulated time. Disabled when determinism is required, as the CPU could still race the
+  // worker by touching memory the uCode is using.
+  bool HasWorkerThread() const { return m_has_worker_thread; }
+  void RunOnWorkerThread(std::function<void()> work);
+
 private:
   void SendMailToDSP(u32 mail);
 
+  // Waits for the worker thread, but keeps its mails held back
+  void WaitForWorkerThread();
+  // Waits for the worker thread and delivers its mails
+  void FinishWorkerThreadWork();
+
   // Fake mailbox utility
   struct DSPState
   {
@@ -78,6 +92,11 @@ private:
   u64 m_control_reg_init_code_clear_time = 0;
   CMailHandler m_mail_handler;
 
+  // Declared after the uCodes, so it is shut down before they are destroyed
+  Common::AsyncWorkThreadSP m_worker_thread;
+  bool m_has_worker_thread = false;
+  bool m_worker_thread_work_pending = false;
+
   Core::System& m_system;
 };
 }  // namespace DSP::HLE
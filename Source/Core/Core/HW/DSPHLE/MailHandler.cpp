@@ -21,6 +21,12 @@ CMailHandler::~CMailHandler()
 
 void CMailHandler::PushMail(u32 mail, bool interrupt, int cycles_into_future)
 {
+  if (m_holding_mails)
+  {
+    m_held_mails.emplace_back(mail, interrupt, cycles_into_future);
+    return;
+  }
+
   if (interrupt)
   {
     if (m_pending_mails.empty())
@@ -72,6 +78,20 @@ u16 CMailHandler::ReadDSPMailboxLow()
 void CMailHandler::ClearPending()
 {
   m_pending_mails.clear();
+  m_held_mails.clear();
+}
+
+void CMailHandler::HoldMails()
+{
+  m_holding_mails = true;
+}
+
+void CMailHandler::ReleaseMails()
+{
+  m_holding_mails = false;
+  for (const auto& [mail, interrupt, cycles_into_future] : m_held_mails)
+    PushMail(mail, interrupt, cycles_into_future);
+  m_held_mails.clear();
 }
 
 bool CMailHandler::HasPending() const
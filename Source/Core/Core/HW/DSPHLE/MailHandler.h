@@ -4,7 +4,9 @@
 #pragma once
 
 #include <deque>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -39,6 +41,12 @@ public:
   // until the new uCode sends mail.
   void ClearPending();
 
+  // While mails are held, mails pushed by the uCode are queued up instead of being delivered, so
+  // uCode work running on the DSPHLE worker thread never touches what the CPU reads. ReleaseMails
+  // delivers them in order, as if they were pushed right then.
+  void HoldMails();
+  void ReleaseMails();
+
   u16 ReadDSPMailboxHigh();
   u16 ReadDSPMailboxLow();
 
@@ -53,6 +61,10 @@ private:
   // When halted, the DSP itself is not running, but the last mail can be read.
   bool m_halted = false;
 
+  bool m_holding_mails = false;
+  // Mail, interrupt and interrupt delay of each held mail
+  std::vector<std::tuple<u32, bool, int>> m_held_mails;
+
   DSP::DSPManager& m_dsp;
 };
 }  // namespace DSP::HLE
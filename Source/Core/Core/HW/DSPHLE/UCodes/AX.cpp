@@ -742,9 +742,21 @@ void AXUCode::HandleMail(u32 mail)
 
   case MailState::WaitingForCmdListAddress:
     CopyCmdList(mail, m_cmdlist_size);
-    HandleCommandList();
     m_cmdlist_size = 0;
-    SignalWorkEnd();
+    if (m_dsphle->HasWorkerThread())
+    {
+      // The command list has been copied, so the worker thread only needs the PBs and buffers it
+      // refers to, which the game leaves alone until the DSP is done with them.
+      m_dsphle->RunOnWorkerThread([this] {
+        HandleCommandList();
+        SignalWorkEnd();
+      });
+    }
+    else
+    {
+      HandleCommandList();
+      SignalWorkEnd();
+    }
     m_mail_state = MailState::WaitingForNextTask;
     break;
 
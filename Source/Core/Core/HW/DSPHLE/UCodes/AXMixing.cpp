@@ -0,0 +1,129 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+#include <algorithm>
+#include <array>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE::AXMixing
+{
+static s16 ScaleSample(s16 sample, u16 volume, bool signed_volume)
+{
+  const s32 factor = signed_volume ? s32(s16(volume)) : s32(volume);
+  return static_cast<s16>(std::clamp<s32>((s32(sample) * factor) >> 15, -0x8000, 0x7FFF));
+}
+
+u16 ScaleSamples(s16* output, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                 bool signed_volume)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  // Eight samples are processed at a time, each lane holding the volume of its own sample. Both
+  // the volume and the products of two 16-bit values fit in the vector lanes without any loss.
+  static constexpr std::array<u16, 8> LANE_INDICES = {0, 1, 2, 3, 4, 5, 6, 7};
+  const u16 volume_step = static_cast<u16>(volume_delta * 8);
+#endif
+
+#if defined(_M_X86_64)
+  const __m128i lane_indices =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(LANE_INDICES.data()));
+  __m128i volumes = _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(volume)),
+                                  _mm_mullo_epi16(_mm_set1_epi16(static_cast<s16>(volume_delta)),
+                                                  lane_indices));
+  const __m128i step = _mm_set1_epi16(static_cast<s16>(volume_step));
+
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    const __m128i low = _mm_mullo_epi16(samples, volumes);
+    __m128i high = _mm_mulhi_epi16(samples, volumes);
+    // PMULHW treats the volume as signed, which is 0x10000 too small for unsigned volumes of
+    // 0x8000 and above. Correct the high half of the product by adding the sample back.
+    if (!signed_volume)
+      high = _mm_add_epi16(high, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+
+    const __m128i products_low = _mm_srai_epi32(_mm_unpacklo_epi16(low, high), 15);
+    const __m128i products_high = _mm_srai_epi32(_mm_unpackhi_epi16(low, high), 15);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                     _mm_packs_epi32(products_low, products_high));
+
+    volumes = _mm_add_epi16(volumes, step);
+  }
+#elif defined(_M_ARM_64)
+  uint16x8_t volumes =
+      vaddq_u16(vdupq_n_u16(volume), vmulq_n_u16(vld1q_u16(LANE_INDICES.data()), volume_delta));
+  const uint16x8_t step = vdupq_n_u16(volume_step);
+
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t samples = vld1q_s16(input + i);
+    int32x4_t products_low;
+    int32x4_t products_high;
+    if (signed_volume)
+    {
+      const int16x8_t signed_volumes = vreinterpretq_s16_u16(volumes);
+      products_low = vmull_s16(vget_low_s16(samples), vget_low_s16(signed_volumes));
+      products_high = vmull_high_s16(samples, signed_volumes);
+    }
+    else
+    {
+      products_low = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                               vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volumes))));
+      products_high = vmulq_s32(vmovl_high_s16(samples),
+                                vreinterpretq_s32_u32(vmovl_high_u16(volumes)));
+    }
+
+    vst1q_s16(output + i, vcombine_s16(vqmovn_s32(vshrq_n_s32(products_low, 15)),
+                                       vqmovn_s32(vshrq_n_s32(products_high, 15))));
+
+    volumes = vaddq_u16(volumes, step);
+  }
+#endif
+
+  volume = static_cast<u16>(volume + volume_delta * i);
+  for (; i < count; ++i)
+  {
+    output[i] = ScaleSample(input[i], volume, signed_volume);
+    volume += volume_delta;
+  }
+
+  return volume;
+}
+
+void AddSamples(int* output, const s16* input, u32 count)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    // Sign extend by moving each sample to the upper half of a 32-bit lane
+    const __m128i samples_low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+    const __m128i samples_high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+    __m128i* const out = reinterpret_cast<__m128i*>(output + i);
+    _mm_storeu_si128(out, _mm_add_epi32(_mm_loadu_si128(out), samples_low));
+    _mm_storeu_si128(out + 1, _mm_add_epi32(_mm_loadu_si128(out + 1), samples_high));
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t samples = vld1q_s16(input + i);
+    vst1q_s32(output + i, vaddw_s16(vld1q_s32(output + i), vget_low_s16(samples)));
+    vst1q_s32(output + i + 4, vaddw_high_s16(vld1q_s32(output + i + 4), samples));
+  }
+#endif
+
+  for (; i < count; ++i)
+    output[i] += input[i];
+}
+}  // namespace DSP::HLE::AXMixing
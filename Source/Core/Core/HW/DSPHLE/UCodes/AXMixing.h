@@ -0,0 +1,23 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Vectorized sample kernels shared by the AX GC and AX Wii voice processing in AXVoice.h. They
+// produce exactly the same output as a scalar loop doing the DSP's 1.15 fixed-point
+// multiplications.
+namespace DSP::HLE::AXMixing
+{
+// Computes output[i] = clamp((input[i] * volume) >> 15), adding volume_delta to the volume after
+// each sample, with the volume wrapping around like the 16-bit DSP register holding it. The volume
+// is interpreted as s16 if signed_volume is set and as u16 otherwise. output may alias input.
+//
+// Returns the volume after the last sample.
+u16 ScaleSamples(s16* output, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                 bool signed_volume);
+
+// Computes output[i] += input[i].
+void AddSamples(int* output, const s16* input, u32 count);
+}  // namespace DSP::HLE::AXMixing
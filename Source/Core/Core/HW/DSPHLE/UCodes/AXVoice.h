@@ -12,15 +12,17 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <functional>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -187,16 +189,34 @@ void AcceleratorSetup(HLEAccelerator* accelerator, PB_TYPE* pb)
   accelerator->SetPredScale(pb->adpcm.pred_scale);
 }
 
-// Reads a sample from the accelerator. Also handles looping and
+// Reads samples from the accelerator. Also handles looping and
 // disabling streams that reached the end (this is done by an exception raised
 // by the accelerator on real hardware).
-u16 AcceleratorGetSample(HLEAccelerator* accelerator)
+void AcceleratorGetSamples(HLEAccelerator* accelerator, s16* samples, u32 count)
 {
-  return accelerator->ReadSample(accelerator->acc_pb->adpcm.coefs);
+  accelerator->ReadSamples(samples, count, accelerator->acc_pb->adpcm.coefs);
 }
 
-// Reads samples from the input callback, resamples them to <count> samples at
-// the wanted sample rate (computed from the ratio, see below).
+// Returns how many input samples ResampleAudio consumes to produce <count>
+// samples, using the same position arithmetic.
+u32 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio, int srctype)
+{
+  if (srctype != SRCTYPE_LINEAR && srctype != SRCTYPE_POLYPHASE)
+    return count;
+
+  u32 input_count = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    input_count += curr_pos >> 16;
+    curr_pos &= 0xFFFF;
+  }
+  return input_count;
+}
+
+// Reads samples from the input buffer, resamples them to <count> samples at
+// the wanted sample rate (computed from the ratio, see below). The input must
+// hold at least as many samples as GetResampleInputCount returns.
 //
 // If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
 // (or the srctype will automatically be changed to LINEAR).
@@ -215,8 +235,8 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
-                  u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
+u32 ResampleAudio(const s16* input, s16* output, u32 count, s16* last_samples, u32 curr_pos,
+                  u32 ratio, int srctype, const s16* coeffs)
 {
   int read_samples_count = 0;
 
@@ -236,7 +256,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       curr_pos += ratio;
       while (curr_pos >= 0x10000)
       {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
+        temp[idx++ & 3] = input[read_samples_count++];
         curr_pos -= 0x10000;
       }
 
@@ -279,7 +299,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       // circular buffer.
       while (curr_pos >= 0x10000)
       {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
+        temp[idx++ & 3] = input[read_samples_count++];
         curr_pos -= 0x10000;
       }
 
@@ -316,10 +336,9 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   }
   else  // SRCTYPE_NEAREST
   {
-    // No sample rate conversion here: simply read samples from the
-    // accelerator to the output buffer.
-    for (u32 i = 0; i < count; ++i)
-      output[i] = input_callback(i);
+    // No sample rate conversion here: simply copy the input samples to the
+    // output buffer.
+    std::copy_n(input, count, output);
 
     memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
   }
@@ -336,9 +355,23 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // Decode everything the resampler is going to consume in one go. Only unusually
+  // high ratios need more than the buffer on the stack.
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const u32 input_count = GetResampleInputCount(count, pb.src.cur_addr_frac, ratio, pb.src_type);
+  std::array<s16, MAX_SAMPLES_PER_FRAME * 8> input_buffer;
+  std::vector<s16> large_input_buffer;
+  s16* input = input_buffer.data();
+  if (input_count > input_buffer.size())
+  {
+    large_input_buffer.resize(input_count);
+    input = large_input_buffer.data();
+  }
+  AcceleratorGetSamples(accelerator, input, input_count);
+
+  u32 curr_pos = ResampleAudio(input, samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
+                               ratio, pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -357,27 +390,17 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
-  // mixing loop can avoid testing if volume ramping is enabled at each step,
-  // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
+  if (count == 0)
+    return;
 
-    out[i] += sample16;
-    volume += volume_delta;
+  // If volume ramping is disabled, the volume stays the same for the whole
+  // frame, as if volume_delta was 0.
+  s16 samples[MAX_SAMPLES_PER_FRAME];
+  vd->volume = AXMixing::ScaleSamples(samples, input, count, vd->volume,
+                                      ramp ? vd->volume_delta : 0, false);
+  AXMixing::AddSamples(out, samples, count);
 
-    *dpop = sample16;
-  }
+  *dpop = samples[count - 1];
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -430,19 +453,16 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  pb.vol_env.cur_volume = static_cast<s16>(
+      AXMixing::ScaleSamples(samples, samples, count, pb.vol_env.cur_volume,
+                             pb.vol_env.cur_volume_delta, signed_volume));
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
@@ -566,9 +586,8 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 
     // We use ratio 0x55555 == (5 * 65536 + 21845) / 65536 == 5.3333 which
     // is the nearest we can get to 96/18
-    u32 curr_pos = ResampleAudio([&samples](u32 i) { return samples[i]; }, wm_samples, wm_count,
-                                 pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
-                                 SRCTYPE_POLYPHASE, coeffs);
+    u32 curr_pos = ResampleAudio(samples, wm_samples, wm_count, pb.remote_src.last_samples,
+                                 pb.remote_src.cur_addr_frac, 0x55555, SRCTYPE_POLYPHASE, coeffs);
     pb.remote_src.cur_addr_frac = curr_pos & 0xFFFF;
 
 // Mix to main[0-3] and aux[0-3]
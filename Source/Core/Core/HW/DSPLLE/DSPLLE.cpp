@@ -84,7 +84,7 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
   }
 }
 
-static bool LoadDSPRom(u16* rom, const std::string& filename, u32 size_in_bytes)
+bool LoadDSPRom(u16* rom, const std::string& filename, u32 size_in_bytes)
 {
   std::string bytes;
   if (!File::ReadFileToString(filename, bytes))
@@ -120,10 +120,14 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
     return false;
 
   opts->core_type = DSPInitOptions::CoreType::Interpreter;
-#ifdef _M_X86_64
   if (Config::Get(Config::MAIN_DSP_JIT))
+  {
+#ifdef _M_X86_64
     opts->core_type = DSPInitOptions::CoreType::JIT64;
+#else
+    opts->core_type = DSPInitOptions::CoreType::CachedInterpreter;
 #endif
+  }
 
   if (Config::Get(Config::MAIN_DSP_CAPTURE_LOG))
   {
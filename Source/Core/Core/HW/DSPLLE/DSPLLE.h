@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <string>
 #include <thread>
 
 #include "Common/CommonTypes.h"
@@ -52,4 +53,7 @@ private:
   Common::Event m_ppc_event;
   bool m_request_disable_thread = false;
 };
+
+// Loads a big endian DSP ROM dump, such as dsp_rom.bin or dsp_coef.bin.
+bool LoadDSPRom(u16* rom, const std::string& filename, u32 size_in_bytes);
 }  // namespace DSP::LLE
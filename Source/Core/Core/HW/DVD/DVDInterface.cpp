@@ -131,21 +131,13 @@ size_t DVDInterface::ProcessDTKSamples(s16* target_samples, size_t target_block_
 {
   const size_t block_count_to_process =
       std::min(target_block_count, audio_data.size() / StreamADPCM::ONE_BLOCK_SIZE);
-  size_t samples_processed = 0;
-  size_t bytes_processed = 0;
-  for (size_t i = 0; i < block_count_to_process; ++i)
-  {
-    m_adpcm_decoder.DecodeBlock(&target_samples[samples_processed * 2],
-                                &audio_data[bytes_processed]);
-    for (size_t j = 0; j < StreamADPCM::SAMPLES_PER_BLOCK * 2; ++j)
-    {
-      // TODO: Fix the mixer so it can accept non-byte-swapped samples.
-      s16* sample = &target_samples[samples_processed * 2 + j];
-      *sample = Common::swap16(*sample);
-    }
-    samples_processed += StreamADPCM::SAMPLES_PER_BLOCK;
-    bytes_processed += StreamADPCM::ONE_BLOCK_SIZE;
-  }
+  m_adpcm_decoder.DecodeBlocks(target_samples, audio_data.data(), block_count_to_process);
+
+  // TODO: Fix the mixer so it can accept non-byte-swapped samples.
+  const size_t sample_count = block_count_to_process * StreamADPCM::SAMPLES_PER_BLOCK * 2;
+  for (size_t i = 0; i < sample_count; ++i)
+    target_samples[i] = Common::swap16(target_samples[i]);
+
   return block_count_to_process;
 }
 
@@ -15,6 +15,10 @@
 #include <span>
 #include <tuple>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -228,6 +232,13 @@ bool MemoryManager::InitFastmemArena()
     }
   }
 
+#ifdef _WIN32
+  // Views must be aligned to the allocation granularity, which is larger than a PPC page.
+  m_can_map_page_table_translations = false;
+#else
+  m_can_map_page_table_translations = sysconf(_SC_PAGESIZE) == PowerPC::HW_PAGE_SIZE;
+#endif
+
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
   return true;
@@ -235,6 +246,10 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // BAT translations take priority over the page table, so let the MMU find the page table
+  // translations again once the new BAT mappings are in place.
+  ClearPageTableTranslations();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -305,6 +320,70 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+void MemoryManager::MapPageTableTranslation(u32 logical_address, u32 physical_address)
+{
+  // Every mapping is a separate host memory mapping, and the number of those is limited.
+  constexpr size_t MAX_PAGE_TABLE_MAPPINGS = 0x4000;
+
+  if (!m_can_map_page_table_translations ||
+      m_page_table_mapped_entries.size() >= MAX_PAGE_TABLE_MAPPINGS ||
+      m_page_table_mapped_entries.contains(logical_address))
+  {
+    return;
+  }
+
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active || physical_address - region.physical_address >= region.size)
+      continue;
+
+    const u32 position = region.shm_position + physical_address - region.physical_address;
+    u8* base = m_logical_base + logical_address;
+    void* mapped_pointer = m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base);
+    if (!mapped_pointer)
+    {
+      WARN_LOG_FMT(MEMMAP, "Failed to map physical page 0x{:08X} at logical address 0x{:08X}",
+                   physical_address, logical_address);
+      return;
+    }
+    m_page_table_mapped_entries.emplace(logical_address, mapped_pointer);
+    return;
+  }
+}
+
+void MemoryManager::UnmapPageTableTranslations(u32 logical_address, u32 size)
+{
+  const u64 end = u64{logical_address} + size;
+  auto it = m_page_table_mapped_entries.lower_bound(logical_address);
+  while (it != m_page_table_mapped_entries.end() && it->first < end)
+  {
+    m_arena.UnmapFromMemoryRegion(it->second, PowerPC::HW_PAGE_SIZE);
+    it = m_page_table_mapped_entries.erase(it);
+  }
+}
+
+void MemoryManager::UnmapPageTableTranslationsInTLBSet(u32 tlb_index)
+{
+  for (auto it = m_page_table_mapped_entries.begin(); it != m_page_table_mapped_entries.end();)
+  {
+    if (((it->first >> PowerPC::HW_PAGE_INDEX_SHIFT) & PowerPC::HW_PAGE_INDEX_MASK) != tlb_index)
+    {
+      ++it;
+      continue;
+    }
+
+    m_arena.UnmapFromMemoryRegion(it->second, PowerPC::HW_PAGE_SIZE);
+    it = m_page_table_mapped_entries.erase(it);
+  }
+}
+
+void MemoryManager::ClearPageTableTranslations()
+{
+  for (const auto& [logical_address, mapped_pointer] : m_page_table_mapped_entries)
+    m_arena.UnmapFromMemoryRegion(mapped_pointer, PowerPC::HW_PAGE_SIZE);
+  m_page_table_mapped_entries.clear();
+}
+
 void MemoryManager::DoState(PointerWrap& p)
 {
   const u32 current_ram_size = GetRamSize();
@@ -392,6 +471,9 @@ void MemoryManager::ShutdownFastmemArena()
   }
   m_logical_mapped_entries.clear();
 
+  ClearPageTableTranslations();
+  m_can_map_page_table_translations = false;
+
   m_arena.ReleaseMemoryRegion();
 
   m_fastmem_arena = nullptr;
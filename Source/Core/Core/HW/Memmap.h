@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
 #include <span>
 #include <string>
@@ -101,6 +102,16 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Mirrors a page table translation of the page at logical_address into the logical fastmem
+  // view. Does nothing if the physical page isn't backed by memory or if the host can't map pages
+  // this small. Any page table mappings are removed again by UpdateLogicalMemory.
+  void MapPageTableTranslation(u32 logical_address, u32 physical_address);
+  void UnmapPageTableTranslations(u32 logical_address, u32 size);
+  // Unmaps every page which shares the given set of the emulated TLB, in all segments
+  void UnmapPageTableTranslationsInTLBSet(u32 tlb_index);
+  void ClearPageTableTranslations();
+  bool CanMapPageTableTranslations() const { return m_can_map_page_table_translations; }
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -195,6 +206,7 @@ private:
   u32 m_exram_mask = 0;
 
   bool m_is_fastmem_arena_initialized = false;
+  bool m_can_map_page_table_translations = false;
 
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
@@ -232,7 +244,8 @@ private:
   //
   // The 4GB starting at m_logical_base represents access from the CPU
   // with address translation turned on.  This mapping is computed based
-  // on the BAT registers.
+  // on the BAT registers, plus the page table translations the MMU has
+  // found for pages no BAT covers.
   //
   // Each of these 4GB regions is surrounded by 2GB of empty space so overflows
   // in address computation in the JIT don't access unrelated memory.
@@ -249,6 +262,11 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  // Pages of the logical view which are mapped based on the page table rather than the BATs,
+  // keyed by logical address. They're added as the MMU finds translations and are removed on
+  // tlbie, segment register and SDR1 writes, and whenever the BATs change.
+  std::map<u32, void*> m_page_table_mapped_entries;
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
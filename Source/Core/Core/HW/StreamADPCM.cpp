@@ -6,67 +6,99 @@
 #include "Core/HW/StreamADPCM.h"
 
 #include <algorithm>
+#include <array>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
-{
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
-  hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
+// The prediction filters selected by the upper nibble of the block header. Only the first four
+// filters exist, the others don't use the previous samples at all.
+static constexpr std::array<std::array<s32, 2>, 4> FILTER_COEFFICIENTS = {{
+    {0, 0},
+    {0x3c, 0},
+    {0x73, -0x34},
+    {0x62, -0x37},
+}};
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+static s16 ADPDecodeSample(s32 bits, s32 scale_shift, s32 coef1, s32 coef2, s32& hist1, s32& hist2)
+{
+  const s32 hist = std::clamp((hist1 * coef1 + hist2 * coef2 + 0x20) >> 6, -0x200000, 0x1fffff);
+  const s32 cur = ((static_cast<s16>(bits << 12) >> scale_shift) << 6) + hist;
 
   hist2 = hist1;
   hist1 = cur;
 
-  cur >>= 6;
-  cur = std::clamp(cur, -0x8000, 0x7fff);
+  return static_cast<s16>(std::clamp(cur >> 6, -0x8000, 0x7fff));
+}
+
+// The filters are template parameters, so the compiler can turn the multiplications into shifts
+// and adds. Both channels are decoded in the same loop, so the CPU can overlap their dependency
+// chains.
+template <std::size_t left_filter, std::size_t right_filter>
+static void DecodeBlockWithFilters(s16* pcm, const u8* adpcm, ADPCMDecoder::History* history)
+{
+  constexpr s32 left_coef1 = FILTER_COEFFICIENTS[left_filter][0];
+  constexpr s32 left_coef2 = FILTER_COEFFICIENTS[left_filter][1];
+  constexpr s32 right_coef1 = FILTER_COEFFICIENTS[right_filter][0];
+  constexpr s32 right_coef2 = FILTER_COEFFICIENTS[right_filter][1];
 
-  return (s16)cur;
+  const u8* const data = adpcm + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK);
+  const s32 left_shift = adpcm[0] & 0xf;
+  const s32 right_shift = adpcm[1] & 0xf;
+  s32 histl1 = history->histl1;
+  s32 histl2 = history->histl2;
+  s32 histr1 = history->histr1;
+  s32 histr2 = history->histr2;
+  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+  {
+    pcm[i * 2] = ADPDecodeSample(data[i] & 0xf, left_shift, left_coef1, left_coef2, histl1, histl2);
+    pcm[i * 2 + 1] =
+        ADPDecodeSample(data[i] >> 4, right_shift, right_coef1, right_coef2, histr1, histr2);
+  }
+  *history = {histl1, histl2, histr1, histr2};
+}
+
+template <std::size_t... filters>
+static constexpr auto MakeBlockDecoders(std::index_sequence<filters...>)
+{
+  using BlockDecoder = void (*)(s16*, const u8*, ADPCMDecoder::History*);
+  return std::array<BlockDecoder, sizeof...(filters)>{
+      &DecodeBlockWithFilters<filters / 4, filters % 4>...};
+}
+
+// Indexed by left filter * 4 + right filter
+static constexpr auto BLOCK_DECODERS = MakeBlockDecoders(std::make_index_sequence<16>());
+
+static std::size_t GetFilter(u8 header)
+{
+  const std::size_t filter = header >> 4;
+  return filter < FILTER_COEFFICIENTS.size() ? filter : 0;
 }
 
 void ADPCMDecoder::ResetFilter()
 {
-  m_histl1 = 0;
-  m_histl2 = 0;
-  m_histr1 = 0;
-  m_histr2 = 0;
+  m_history = {};
 }
 
 void ADPCMDecoder::DoState(PointerWrap& p)
 {
-  p.Do(m_histl1);
-  p.Do(m_histl2);
-  p.Do(m_histr1);
-  p.Do(m_histr2);
+  p.Do(m_history.histl1);
+  p.Do(m_history.histl2);
+  p.Do(m_history.histr1);
+  p.Do(m_history.histr2);
 }
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
-  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
-  {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
-  }
+  BLOCK_DECODERS[GetFilter(adpcm[0]) * 4 + GetFilter(adpcm[1])](pcm, adpcm, &m_history);
+}
+
+void ADPCMDecoder::DecodeBlocks(s16* pcm, const u8* adpcm, std::size_t block_count)
+{
+  for (std::size_t i = 0; i < block_count; i++)
+    DecodeBlock(&pcm[i * SAMPLES_PER_BLOCK * 2], &adpcm[i * ONE_BLOCK_SIZE]);
 }
 }  // namespace StreamADPCM
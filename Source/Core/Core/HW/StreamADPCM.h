@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -20,14 +22,21 @@ enum
 class ADPCMDecoder
 {
 public:
+  struct History
+  {
+    s32 histl1 = 0;
+    s32 histl2 = 0;
+    s32 histr1 = 0;
+    s32 histr2 = 0;
+  };
+
   void ResetFilter();
   void DoState(PointerWrap& p);
+  // Decodes ONE_BLOCK_SIZE bytes into SAMPLES_PER_BLOCK interleaved stereo samples
   void DecodeBlock(s16* pcm, const u8* adpcm);
+  void DecodeBlocks(s16* pcm, const u8* adpcm, std::size_t block_count);
 
 private:
-  s32 m_histl1 = 0;
-  s32 m_histl2 = 0;
-  s32 m_histr1 = 0;
-  s32 m_histr2 = 0;
+  History m_history;
 };
 }  // namespace StreamADPCM
@@ -3,8 +3,10 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include <bit>
 #include <span>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
@@ -22,6 +24,7 @@
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -206,6 +209,93 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                                     const LoadImmediateOperands& operands)
+{
+  const auto& [rd, imm, inst] = operands;
+  rd = imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(PowerPC::PowerPCState& ppc_state,
+                                    const IntegerImmediateOperands& operands)
+{
+  const auto& [rd, ra, imm, inst] = operands;
+  rd = ra + imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::OrImmediate(PowerPC::PowerPCState& ppc_state,
+                                   const IntegerImmediateOperands& operands)
+{
+  const auto& [rd, ra, imm, inst] = operands;
+  rd = ra | imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateLeftAndMask(PowerPC::PowerPCState& ppc_state,
+                                         const RotateLeftAndMaskOperands& operands)
+{
+  const auto& [ra, rs, shift, mask, inst] = operands;
+  ra = std::rotl(rs, shift) & mask;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+static u32 CompareImmediateField(const PowerPC::PowerPCState& ppc_state, u32 ra, u32 imm)
+{
+  using T = std::conditional_t<is_signed, s32, u32>;
+  const T a = static_cast<T>(ra);
+  const T b = static_cast<T>(imm);
+
+  u32 cr_field = a < b ? PowerPC::CR_LT : a > b ? PowerPC::CR_GT : PowerPC::CR_EQ;
+  if (ppc_state.GetXER_SO())
+    cr_field |= PowerPC::CR_SO;
+  return cr_field;
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediate(PowerPC::PowerPCState& ppc_state,
+                                        const CompareImmediateOperands& operands)
+{
+  const auto& [ra, imm, crf, inst] = operands;
+  ppc_state.cr.SetField(crf, CompareImmediateField<is_signed>(ppc_state, ra, imm));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareAndBranch(PowerPC::PowerPCState& ppc_state,
+                                        const CompareAndBranchOperands& operands)
+{
+  const auto& [ra, imm, crf, current_pc, destination, bi, branch_if_true, inst] = operands;
+  const u32 cr_field = CompareImmediateField<is_signed>(ppc_state, ra, imm);
+  ppc_state.cr.SetField(crf, cr_field);
+
+  // The branch sees the field it was just given, so test the bit without reading it back.
+  const u32 bit = (cr_field >> (3 - (bi & 3))) & 1;
+  ppc_state.pc = current_pc;
+  ppc_state.npc = bit == branch_if_true ? destination : current_pc + 4;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadWord(PowerPC::PowerPCState& ppc_state,
+                                const LoadStoreWordOperands& operands)
+{
+  const auto& [mmu, rd, ra, offset, inst] = operands;
+  const u32 value = mmu.Read_U32(ra + offset);
+  if (!(ppc_state.Exceptions & EXCEPTION_DSI))
+    rd = value;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::StoreWord(PowerPC::PowerPCState& ppc_state,
+                                 const LoadStoreWordOperands& operands)
+{
+  const auto& [mmu, rs, ra, offset, inst] = operands;
+  mmu.Write_U32(rs, ra + offset);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -237,6 +327,92 @@ void CachedInterpreter::WriteEndBlock()
   }
 }
 
+bool CachedInterpreter::WritePredecodedInstruction(const PPCAnalyst::CodeOp& op)
+{
+  const UGeckoInstruction inst = op.inst;
+  auto& gpr = m_ppc_state.gpr;
+
+  switch (inst.OPCD)
+  {
+  case 14:  // addi
+  case 15:  // addis
+  {
+    const u32 imm = inst.OPCD == 14 ? u32(inst.SIMM_16) : inst.SIMM_16 << 16;
+    if (inst.RA == 0)
+      Write(LoadImmediate, {gpr[inst.RD], imm, inst});
+    else
+      Write(AddImmediate, {gpr[inst.RD], gpr[inst.RA], imm, inst});
+    return true;
+  }
+  case 24:  // ori
+  case 25:  // oris
+  {
+    const u32 imm = inst.OPCD == 24 ? inst.UIMM : inst.UIMM << 16;
+    Write(OrImmediate, {gpr[inst.RA], gpr[inst.RS], imm, inst});
+    return true;
+  }
+  case 21:  // rlwinmx
+    if (inst.Rc)
+      return false;
+    Write(RotateLeftAndMask,
+          {gpr[inst.RA], gpr[inst.RS], inst.SH, MakeRotationMask(inst.MB, inst.ME), inst});
+    return true;
+  case 10:  // cmpli
+    Write(CompareImmediate<false>, {gpr[inst.RA], inst.UIMM, inst.CRFD, inst});
+    return true;
+  case 11:  // cmpi
+    Write(CompareImmediate<true>, {gpr[inst.RA], u32(inst.SIMM_16), inst.CRFD, inst});
+    return true;
+  case 32:  // lwz
+    if (inst.RA == 0)
+      return false;
+    Write(LoadWord, {m_mmu, gpr[inst.RD], gpr[inst.RA], u32(inst.SIMM_16), inst});
+    return true;
+  case 36:  // stw
+    if (inst.RA == 0)
+      return false;
+    Write(StoreWord, {m_mmu, gpr[inst.RS], gpr[inst.RA], u32(inst.SIMM_16), inst});
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool CachedInterpreter::WriteCompareAndBranch(const PPCAnalyst::CodeOp& op,
+                                              const PPCAnalyst::CodeOp& next_op)
+{
+  // Only fuse a compare with a bc which tests nothing but the field it just wrote. Branch Watch
+  // and breakpoints need the branch to be interpreted on its own.
+  const UGeckoInstruction inst = op.inst;
+  const UGeckoInstruction branch = next_op.inst;
+  if ((inst.OPCD != 10 && inst.OPCD != 11) || next_op.skip || branch.OPCD != 16 || branch.LK ||
+      (branch.BO & BO_DONT_DECREMENT_FLAG) == 0 || (branch.BO & BO_DONT_CHECK_CONDITION) != 0 ||
+      branch.BI >> 2 != inst.CRFD || IsDebuggingEnabled())
+  {
+    return false;
+  }
+  if (HLE::TryReplaceFunction(m_ppc_symbol_db, next_op.address, PowerPC::CoreMode::JIT))
+    return false;
+
+  u32 destination = u32(SignExt16(s16(branch.BD << 2)));
+  if (!branch.AA)
+    destination += next_op.address;
+
+  const CompareAndBranchOperands operands = {
+      m_ppc_state.gpr[inst.RA],
+      inst.OPCD == 11 ? u32(inst.SIMM_16) : inst.UIMM,
+      inst.CRFD,
+      next_op.address,
+      destination,
+      branch.BI,
+      (branch.BO >> 3) & 1u,
+      inst};
+  Write(inst.OPCD == 11 ? CallbackCast(CompareAndBranch<true>) :
+                          CallbackCast(CompareAndBranch<false>),
+        operands);
+  return true;
+}
+
 bool CachedInterpreter::SetEmitterStateToFreeCodeRegion()
 {
   const auto free = m_free_ranges.by_size_begin();
@@ -339,6 +515,8 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   auto& power_pc = m_system.GetPowerPC();
   auto& cpu = m_system.GetCPU();
   auto& breakpoints = power_pc.GetBreakPoints();
+  // Set when the previous instruction was fused with this one
+  bool already_written = false;
 
   if (IsProfilingEnabled())
     Write(StartProfiledBlock, {js.curBlock->profile_data.get()});
@@ -372,9 +550,13 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.firstFPInstructionFound = true;
       }
 
+      if (std::exchange(already_written, false))
+      {
+        // The branch was executed by CompareAndBranch; only the end of the block is left to write.
+      }
       // Instruction may cause a DSI Exception or Program Exception.
-      if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
-          (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
+      else if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
+               (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
       {
         const InterpretAndCheckExceptionsOperands operands = {
             {interpreter, Interpreter::GetInterpreterOp(op.inst), js.compilerPC, op.inst},
@@ -384,7 +566,12 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
                                CallbackCast(InterpretAndCheckExceptions<false>),
               operands);
       }
-      else
+      else if (!op.canEndBlock && i + 1 < code_block.m_num_instructions &&
+               WriteCompareAndBranch(op, m_code_buffer[i + 1]))
+      {
+        already_written = true;
+      }
+      else if (op.canEndBlock || !WritePredecodedInstruction(op))
       {
         const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
                                             js.compilerPC, op.inst};
@@ -64,6 +64,13 @@ private:
   bool HandleFunctionHooking(u32 address);
   void WriteEndBlock();
 
+  // Writes a callback with pre-decoded operands for some of the most common instructions.
+  // Returns false if the instruction has to be interpreted instead.
+  bool WritePredecodedInstruction(const PPCAnalyst::CodeOp& op);
+  // Writes a single callback for a compare immediately followed by a conditional branch on its
+  // result. Returns false if the instructions can't be fused.
+  bool WriteCompareAndBranch(const PPCAnalyst::CodeOp& op, const PPCAnalyst::CodeOp& next_op);
+
   // Finds a free memory region and sets the code emitter to point at that region.
   // Returns false if no free memory region can be found.
   bool SetEmitterStateToFreeCodeRegion();
@@ -82,6 +89,12 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct LoadImmediateOperands;
+  struct IntegerImmediateOperands;
+  struct RotateLeftAndMaskOperands;
+  struct CompareImmediateOperands;
+  struct CompareAndBranchOperands;
+  struct LoadStoreWordOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& operands);
@@ -112,6 +125,34 @@ private:
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
 
+  // Pre-decoded instructions
+  static s32 LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                           const LoadImmediateOperands& operands);
+  static s32 LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands);
+  static s32 AddImmediate(PowerPC::PowerPCState& ppc_state,
+                          const IntegerImmediateOperands& operands);
+  static s32 AddImmediate(std::ostream& stream, const IntegerImmediateOperands& operands);
+  static s32 OrImmediate(PowerPC::PowerPCState& ppc_state,
+                         const IntegerImmediateOperands& operands);
+  static s32 OrImmediate(std::ostream& stream, const IntegerImmediateOperands& operands);
+  static s32 RotateLeftAndMask(PowerPC::PowerPCState& ppc_state,
+                               const RotateLeftAndMaskOperands& operands);
+  static s32 RotateLeftAndMask(std::ostream& stream, const RotateLeftAndMaskOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediate(PowerPC::PowerPCState& ppc_state,
+                              const CompareImmediateOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediate(std::ostream& stream, const CompareImmediateOperands& operands);
+  template <bool is_signed>
+  static s32 CompareAndBranch(PowerPC::PowerPCState& ppc_state,
+                              const CompareAndBranchOperands& operands);
+  template <bool is_signed>
+  static s32 CompareAndBranch(std::ostream& stream, const CompareAndBranchOperands& operands);
+  static s32 LoadWord(PowerPC::PowerPCState& ppc_state, const LoadStoreWordOperands& operands);
+  static s32 LoadWord(std::ostream& stream, const LoadStoreWordOperands& operands);
+  static s32 StoreWord(PowerPC::PowerPCState& ppc_state, const LoadStoreWordOperands& operands);
+  static s32 StoreWord(std::ostream& stream, const LoadStoreWordOperands& operands);
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -175,3 +216,60 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+// The instruction of the pre-decoded callbacks is only kept for the disassembler.
+struct CachedInterpreter::LoadImmediateOperands
+{
+  u32& rd;
+  u32 imm;
+  UGeckoInstruction inst;
+};
+
+struct CachedInterpreter::IntegerImmediateOperands
+{
+  u32& rd;
+  const u32& ra;
+  u32 imm;
+  UGeckoInstruction inst;
+};
+
+struct CachedInterpreter::RotateLeftAndMaskOperands
+{
+  u32& ra;
+  const u32& rs;
+  u32 shift;
+  u32 mask;
+  UGeckoInstruction inst;
+  u32 : 32;
+};
+
+struct CachedInterpreter::CompareImmediateOperands
+{
+  const u32& ra;
+  u32 imm;
+  u32 crf;
+  UGeckoInstruction inst;
+  u32 : 32;
+};
+
+struct CachedInterpreter::CompareAndBranchOperands
+{
+  const u32& ra;
+  u32 imm;
+  u32 crf;
+  u32 current_pc;
+  u32 destination;
+  u32 bi;
+  u32 branch_if_true;
+  UGeckoInstruction inst;
+  u32 : 32;
+};
+
+struct CachedInterpreter::LoadStoreWordOperands
+{
+  PowerPC::MMU& mmu;
+  u32& rs;
+  const u32& ra;
+  u32 offset;
+  UGeckoInstruction inst;
+};
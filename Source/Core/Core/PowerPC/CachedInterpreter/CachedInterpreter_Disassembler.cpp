@@ -6,11 +6,13 @@
 #include <algorithm>
 #include <array>
 #include <mutex>
+#include <string>
 #include <utility>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "Common/GekkoDisassembler.h"
 #include "Core/HLE/HLE.h"
 
 s32 CachedInterpreterEmitter::PoisonCallback(std::ostream& stream, const void* operands)
@@ -90,6 +92,75 @@ s32 CachedInterpreter::CheckIdle(std::ostream& stream, const CheckIdleOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+static std::string DisassembleInstruction(UGeckoInstruction inst)
+{
+  return Common::GekkoDisassembler::Disassemble(inst.hex, 0);
+}
+
+s32 CachedInterpreter::LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands)
+{
+  fmt::println(stream, "LoadImmediate(imm=0x{:08x}) [{}]", operands.imm,
+               DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(std::ostream& stream, const IntegerImmediateOperands& operands)
+{
+  fmt::println(stream, "AddImmediate(imm=0x{:08x}) [{}]", operands.imm,
+               DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::OrImmediate(std::ostream& stream, const IntegerImmediateOperands& operands)
+{
+  fmt::println(stream, "OrImmediate(imm=0x{:08x}) [{}]", operands.imm,
+               DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateLeftAndMask(std::ostream& stream,
+                                         const RotateLeftAndMaskOperands& operands)
+{
+  fmt::println(stream, "RotateLeftAndMask(shift={}, mask=0x{:08x}) [{}]", operands.shift,
+               operands.mask, DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediate(std::ostream& stream,
+                                        const CompareImmediateOperands& operands)
+{
+  fmt::println(stream, "CompareImmediate<is_signed={:5}>(imm=0x{:08x}, crf={}) [{}]", is_signed,
+               operands.imm, operands.crf, DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareAndBranch(std::ostream& stream,
+                                        const CompareAndBranchOperands& operands)
+{
+  fmt::println(stream,
+               "CompareAndBranch<is_signed={:5}>(imm=0x{:08x}, crf={}, current_pc=0x{:08x}, "
+               "destination=0x{:08x}, bi={}, branch_if_true={}) [{}]",
+               is_signed, operands.imm, operands.crf, operands.current_pc, operands.destination,
+               operands.bi, operands.branch_if_true, DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadWord(std::ostream& stream, const LoadStoreWordOperands& operands)
+{
+  fmt::println(stream, "LoadWord(offset=0x{:08x}) [{}]", operands.offset,
+               DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::StoreWord(std::ostream& stream, const LoadStoreWordOperands& operands)
+{
+  fmt::println(stream, "StoreWord(offset=0x{:08x}) [{}]", operands.offset,
+               DisassembleInstruction(operands.inst));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 static std::once_flag s_sorted_lookup_flag;
 
 std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream& stream)
@@ -115,6 +186,16 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::CheckFPU),
       LOOKUP_KV(CachedInterpreter::CheckBreakpoint),
       LOOKUP_KV(CachedInterpreter::CheckIdle),
+      LOOKUP_KV(CachedInterpreter::LoadImmediate),
+      LOOKUP_KV(CachedInterpreter::AddImmediate),
+      LOOKUP_KV(CachedInterpreter::OrImmediate),
+      LOOKUP_KV(CachedInterpreter::RotateLeftAndMask),
+      LOOKUP_KV(CachedInterpreter::CompareImmediate<false>),
+      LOOKUP_KV(CachedInterpreter::CompareImmediate<true>),
+      LOOKUP_KV(CachedInterpreter::CompareAndBranch<false>),
+      LOOKUP_KV(CachedInterpreter::CompareAndBranch<true>),
+      LOOKUP_KV(CachedInterpreter::LoadWord),
+      LOOKUP_KV(CachedInterpreter::StoreWord),
   });
 
 #undef LOOKUP_KV
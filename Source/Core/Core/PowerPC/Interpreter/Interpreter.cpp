@@ -4,6 +4,7 @@
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 
 #include <array>
+#include <memory>
 #include <string>
 
 #include <fmt/format.h>
@@ -76,6 +77,13 @@ Interpreter::~Interpreter() = default;
 void Interpreter::Init()
 {
   m_end_block = false;
+
+  if (!m_predecoded_instructions)
+  {
+    m_predecoded_instructions =
+        std::make_unique<std::array<PredecodedInstruction, NUM_PREDECODED_INSTRUCTIONS>>();
+  }
+  m_predecoded_instructions->fill({});
 }
 
 void Interpreter::Shutdown()
@@ -118,6 +126,16 @@ bool Interpreter::HandleFunctionHooking(u32 address)
   return result.type != HLE::HookType::Start;
 }
 
+const Interpreter::PredecodedInstruction& Interpreter::Predecode(u32 address,
+                                                                 UGeckoInstruction inst)
+{
+  PredecodedInstruction& record =
+      (*m_predecoded_instructions)[(address >> 2) % NUM_PREDECODED_INSTRUCTIONS];
+  if (record.opinfo == nullptr || record.hex != inst.hex)
+    record = {GetInterpreterOp(inst), PPCTables::GetOpInfo(inst, address), inst.hex};
+  return record;
+}
+
 int Interpreter::SingleStepInner()
 {
   if (HandleFunctionHooking(m_ppc_state.pc))
@@ -132,7 +150,8 @@ int Interpreter::SingleStepInner()
   m_ppc_state.npc = m_ppc_state.pc + sizeof(UGeckoInstruction);
   m_prev_inst.hex = m_mmu.Read_Opcode(m_ppc_state.pc);
 
-  const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(m_prev_inst, m_ppc_state.pc);
+  const PredecodedInstruction& predecoded = Predecode(m_ppc_state.pc, m_prev_inst);
+  const GekkoOPInfo* opinfo = predecoded.opinfo;
 
   // Uncomment to trace the interpreter
   // if ((m_ppc_state.pc & 0x00FFFFFF) >= 0x000AB54C &&
@@ -159,7 +178,7 @@ int Interpreter::SingleStepInner()
     }
     else if (m_ppc_state.msr.FP)
     {
-      RunInterpreterOp(*this, m_prev_inst);
+      predecoded.func(*this, m_prev_inst);
       if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
       {
         CheckExceptions();
@@ -175,7 +194,7 @@ int Interpreter::SingleStepInner()
       }
       else
       {
-        RunInterpreterOp(*this, m_prev_inst);
+        predecoded.func(*this, m_prev_inst);
         if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
         {
           CheckExceptions();
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
 #include "Common/CommonTypes.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -20,6 +21,7 @@ class MMU;
 struct PowerPCState;
 }  // namespace PowerPC
 class PPCSymbolDB;
+struct GekkoOPInfo;
 
 class Interpreter : public CPUCoreBase
 {
@@ -316,12 +318,31 @@ private:
 
   void Trace(const UGeckoInstruction& inst);
 
+  // Decoded form of an instruction, cached by its effective address. A record is only used if the
+  // instruction fetched through the instruction cache is still the one it was decoded from, so
+  // nothing needs to be invalidated when memory, the instruction cache or translation changes.
+  // Records of different addresses may share a slot, which costs nothing more than a redecode.
+  struct PredecodedInstruction
+  {
+    Instruction func = nullptr;
+    const GekkoOPInfo* opinfo = nullptr;
+    u32 hex = 0;
+  };
+
+  // 32 pages worth of instructions
+  static constexpr u32 NUM_PREDECODED_INSTRUCTIONS = 32 * 1024;
+
+  const PredecodedInstruction& Predecode(u32 address, UGeckoInstruction inst);
+
   Core::System& m_system;
   PowerPC::PowerPCState& m_ppc_state;
   PowerPC::MMU& m_mmu;
   Core::BranchWatch& m_branch_watch;
   PPCSymbolDB& m_ppc_symbol_db;
 
+  std::unique_ptr<std::array<PredecodedInstruction, NUM_PREDECODED_INSTRUCTIONS>>
+      m_predecoded_instructions;
+
   UGeckoInstruction m_prev_inst{};
   u32 m_last_pc = 0;
   bool m_end_block = false;
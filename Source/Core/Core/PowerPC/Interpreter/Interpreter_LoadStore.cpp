@@ -633,7 +633,7 @@ void Interpreter::icbi(Interpreter& interpreter, UGeckoInstruction inst)
   const u32 address = Helper_Get_EA_X(ppc_state, inst);
   auto& memory = interpreter.m_system.GetMemory();
   auto& jit_interface = interpreter.m_system.GetJitInterface();
-  ppc_state.iCache.Invalidate(memory, jit_interface, address);
+  ppc_state.iCache.InvalidateFromICBI(memory, jit_interface, address);
 }
 
 void Interpreter::lbzux(Interpreter& interpreter, UGeckoInstruction inst)
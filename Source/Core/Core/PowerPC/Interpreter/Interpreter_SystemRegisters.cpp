@@ -10,6 +10,7 @@
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/Interpreter/ExceptionUtils.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -204,6 +205,7 @@ void Interpreter::mtsr(Interpreter& interpreter, UGeckoInstruction inst)
   const u32 index = inst.SR;
   const u32 value = ppc_state.gpr[inst.RS];
   ppc_state.SetSR(index, value);
+  interpreter.m_mmu.SRUpdated(index);
 }
 
 void Interpreter::mtsrin(Interpreter& interpreter, UGeckoInstruction inst)
@@ -218,6 +220,7 @@ void Interpreter::mtsrin(Interpreter& interpreter, UGeckoInstruction inst)
   const u32 index = (ppc_state.gpr[inst.RB] >> 28) & 0xF;
   const u32 value = ppc_state.gpr[inst.RS];
   ppc_state.SetSR(index, value);
+  interpreter.m_mmu.SRUpdated(index);
 }
 
 void Interpreter::mftb(Interpreter& interpreter, UGeckoInstruction inst)
@@ -612,7 +615,8 @@ void Interpreter::mcrf(Interpreter& interpreter, UGeckoInstruction inst)
 
 void Interpreter::isync(Interpreter& interpreter, UGeckoInstruction inst)
 {
-  // shouldn't do anything
+  // Makes preceding icbi instructions take effect
+  interpreter.m_system.GetJitInterface().FlushPendingICacheInvalidations();
 }
 
 // the following commands read from FPSCR
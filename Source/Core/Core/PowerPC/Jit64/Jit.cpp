@@ -285,6 +285,7 @@ void Jit64::Init()
   m_stack_guard = nullptr;
 
   blocks.Init();
+  blocks.SetDeferInvalidations(true);
   asm_routines.Init();
 
   // important: do this *after* generating the global asm routines, because we can't use farcode in
@@ -310,6 +311,7 @@ void Jit64::ClearCache()
   m_const_pool.Clear();
   ClearCodeSpace();
   Clear();
+  m_branch_bias.clear();
   RefreshConfig();
   asm_routines.Regenerate();
   ResetFreeMemoryRanges();
@@ -786,6 +788,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_LIKELY_BRANCH_FOLLOW);
       }
       Trace();
     }
@@ -1257,23 +1260,22 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_LIKELY_BRANCH_FOLLOW);
 }
 
 void Jit64::IntializeSpeculativeConstants()
 {
   // If the block depends on an input register which looks like a gather pipe or MMIO related
-  // constant, guess that it is actually a constant input, and specialize the block based on this
-  // assumption. This happens when there are branches in code writing to the gather pipe, but only
-  // the first block loads the constant.
+  // constant, or a small data area base pointer, guess that it is actually a constant input, and
+  // specialize the block based on this assumption. This happens when there are branches in code
+  // writing to the gather pipe, but only the first block loads the constant.
   // Insert a check at the start of the block to verify that the value is actually constant.
   // This can save a lot of backpatching and optimize gather pipe writes in more places.
   const u8* target = nullptr;
   for (auto i : code_block.m_gpr_inputs)
   {
     u32 compileTimeValue = m_ppc_state.gpr[i];
-    if (m_mmu.IsOptimizableGatherPipeWrite(compileTimeValue) ||
-        m_mmu.IsOptimizableGatherPipeWrite(compileTimeValue - 0x8000) ||
-        compileTimeValue == 0xCC000000)
+    if (IsSpeculativeConstant(i, compileTimeValue))
     {
       if (!target)
       {
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 
 #include <rangeset/rangesizeset.h>
 
@@ -105,6 +106,8 @@ public:
   void WriteExternalExceptionExit();
   void WriteRfiExitDestInRSCRATCH();
   void WriteIdleExit(u32 destination);
+  bool StartBranchProfile(const PPCAnalyst::CodeOp& op);
+  void WriteBranchBias(const PPCAnalyst::CodeOp& op, bool taken);
   template <bool condition>
   void WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst, Gen::X64Reg reg_a,
                         Gen::X64Reg reg_b, BitSet32 caller_save);
@@ -265,6 +268,7 @@ public:
   void stmw(UGeckoInstruction inst);
 
   void dcbx(UGeckoInstruction inst);
+  void isync(UGeckoInstruction inst);
 
   void eieio(UGeckoInstruction inst);
 
@@ -294,5 +298,10 @@ private:
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
   std::map<u32, int> m_been_here;
+
+  // Number of times each profiled conditional branch was taken minus the number of times it
+  // wasn't since the branch was last compiled. Generated code holds pointers to these, so they are
+  // only removed with the code cache.
+  std::unordered_map<u32, s64> m_branch_bias;
   std::unique_ptr<HostDisassembler> m_disassembler;
 };
@@ -11,6 +11,7 @@
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -28,6 +29,57 @@
 
 using namespace Gen;
 
+// How many more times a conditional branch has to be taken than not before it gets followed
+constexpr s64 LIKELY_TAKEN_BRANCH_BIAS = 1000;
+
+bool Jit64::StartBranchProfile(const PPCAnalyst::CodeOp& op)
+{
+  // Falling back to the interpreter for bcx would assume that the block continues after it.
+  // Branches which have already been found to be likely taken aren't counted anymore, even when
+  // the analyzer ran out of branches to follow.
+  if (!m_enable_branch_following || !m_enable_likely_branch_following || bJITBranchOff ||
+      IsDebuggingEnabled() ||
+      !analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE) ||
+      !analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_LIKELY_BRANCH_FOLLOW) ||
+      op.inst.OPCD != 16 || op.inst.LK || op.branchIsIdleLoop || op.branchIsLikelyTaken ||
+      op.branchTo == js.blockStart || js.likelyTakenBranchAddresses.contains(op.address))
+  {
+    return false;
+  }
+
+  // Start counting from scratch, as the branch may have been invalidated and compiled again since
+  m_branch_bias[op.address] = 0;
+  return true;
+}
+
+void Jit64::WriteBranchBias(const PPCAnalyst::CodeOp& op, bool taken)
+{
+  MOV(64, R(RSCRATCH), ImmPtr(&m_branch_bias[op.address]));
+  if (!taken)
+  {
+    SUB(64, MatR(RSCRATCH), Imm8(1));
+    return;
+  }
+
+  ADD(64, MatR(RSCRATCH), Imm8(1));
+  CMP(64, MatR(RSCRATCH), Imm32(LIKELY_TAKEN_BRANCH_BIAS));
+  FixupBranch likely_taken = J_CC(CC_GE, Jump::Near);
+
+  // This must only be called after flushing, as it recompiles the blocks containing the branch.
+  // That includes the block running right now, so exit to the dispatcher rather than going on.
+  SwitchToFarCode();
+  SetJumpTarget(likely_taken);
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  ABI_CallFunctionPC(JitInterface::CompileLikelyTakenBranchFromJIT, &m_system.GetJitInterface(),
+                     op.address);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+  Cleanup();
+  SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+  MOV(32, PPCSTATE(pc), Imm32(op.branchTo));
+  JMP(asm_routines.dispatcher_no_check, Jump::Near);
+  SwitchToNearCode();
+}
+
 void Jit64::sc(UGeckoInstruction inst)
 {
   INSTRUCTION_START
@@ -208,6 +260,28 @@ void Jit64::bcx(UGeckoInstruction inst)
         JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
   }
 
+  if (js.op->branchIsLikelyTaken)
+  {
+    // The block continues at the branch target, so it only has to be left if the branch isn't
+    // taken. Keep that path out of line.
+    SwitchToFarCode();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      WriteExit(js.compilerPC + 4);
+    }
+    SwitchToNearCode();
+    return;
+  }
+
+  const bool profile_branch = StartBranchProfile(*js.op);
+
   if (inst.LK)
     MOV(32, PPCSTATE_LR, Imm32(js.compilerPC + 4));
 
@@ -243,6 +317,8 @@ void Jit64::bcx(UGeckoInstruction inst)
       // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
       WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, ABI_PARAM1, RSCRATCH, {});
     }
+    if (profile_branch)
+      WriteBranchBias(*js.op, true);
     if (js.op->branchIsIdleLoop)
     {
       WriteIdleExit(js.op->branchTo);
@@ -257,6 +333,8 @@ void Jit64::bcx(UGeckoInstruction inst)
     SetJumpTarget(pConditionDontBranch);
   if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
     SetJumpTarget(pCTRDontBranch);
+  if (profile_branch)
+    WriteBranchBias(*js.op, false);
 
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
@@ -376,6 +376,10 @@ bool Jit64::CheckMergedBranch(u32 crf) const
   if (!CanMergeNextInstructions(1))
     return false;
 
+  // Branches which are followed are left to bcx, which knows how to exit when they aren't taken.
+  if (js.op[1].branchIsLikelyTaken)
+    return false;
+
   const UGeckoInstruction& next = js.op[1].inst;
   return (((next.OPCD == 16 /* bcx */) ||
            ((next.OPCD == 19) && (next.SUBOP10 == 528) /* bcctrx */) ||
@@ -457,6 +461,7 @@ void Jit64::DoMergedBranchCondition()
   int test_bit = 3 - (next.BI & 3);
   bool condition = !!(next.BO & BO_BRANCH_IF_TRUE);
   const u32 nextPC = js.op[1].address;
+  const bool profile_branch = StartBranchProfile(js.op[1]);
 
   ASSERT(gpr.IsAllUnlocked());
 
@@ -488,10 +493,14 @@ void Jit64::DoMergedBranchCondition()
     gpr.Flush();
     fpr.Flush();
 
+    if (profile_branch)
+      WriteBranchBias(js.op[1], true);
     DoMergedBranch();
   }
 
   SetJumpTarget(pDontBranch);
+  if (profile_branch)
+    WriteBranchBias(js.op[1], false);
 
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
@@ -411,6 +411,34 @@ void Jit64::dcbx(UGeckoInstruction inst)
   SetJumpTarget(done);
 }
 
+void Jit64::isync(UGeckoInstruction inst)
+{
+  INSTRUCTION_START
+
+  // Apply the invalidations which icbi has deferred until now. They may cover the rest of this
+  // block, so continue at the next instruction through the dispatcher in that case.
+  MOV(64, R(RSCRATCH), ImmPtr(GetBlockCache()->GetPendingInvalidationsFlag()));
+  CMP(8, MatR(RSCRATCH), Imm8(0));
+  FixupBranch pending = J_CC(CC_NZ, Jump::Near);
+
+  SwitchToFarCode();
+  SetJumpTarget(pending);
+  {
+    RCForkGuard gpr_guard = gpr.Fork();
+    RCForkGuard fpr_guard = fpr.Fork();
+    gpr.Flush();
+    fpr.Flush();
+
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionP(JitInterface::FlushPendingICacheInvalidationsFromJIT,
+                      &m_system.GetJitInterface());
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    asm_routines.ResetStack(*this);
+    WriteExit(js.compilerPC + 4);
+  }
+  SwitchToNearCode();
+}
+
 void Jit64::dcbt(UGeckoInstruction inst)
 {
   INSTRUCTION_START
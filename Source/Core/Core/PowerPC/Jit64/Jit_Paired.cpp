@@ -156,6 +156,9 @@ void Jit64::ps_rsqrte(UGeckoInstruction inst)
   FALLBACK_IF(jo.fp_exceptions || jo.div_by_zero_exceptions);
   int b = inst.FB;
   int d = inst.FD;
+  // If both halves of b are known to be equal, so are both halves of the result (and the flags
+  // the second call would set are already set by the first one).
+  bool duplicated = js.op->fprIsDuplicated[b];
 
   RCX64Reg scratch_guard = gpr.Scratch(RSCRATCH_EXTRA);
   RCX64Reg Rb = fpr.Bind(b, RCMode::Read);
@@ -164,11 +167,18 @@ void Jit64::ps_rsqrte(UGeckoInstruction inst)
 
   MOVSD(XMM0, Rb);
   CALL(asm_routines.frsqrte);
-  MOVSD(Rd, XMM0);
+  if (duplicated)
+  {
+    MOVDDUP(Rd, R(XMM0));
+  }
+  else
+  {
+    MOVSD(Rd, XMM0);
 
-  MOVHLPS(XMM0, Rb);
-  CALL(asm_routines.frsqrte);
-  MOVLHPS(Rd, XMM0);
+    MOVHLPS(XMM0, Rb);
+    CALL(asm_routines.frsqrte);
+    MOVLHPS(Rd, XMM0);
+  }
 
   FinalizeSingleResult(Rd, Rd);
 }
@@ -181,6 +191,8 @@ void Jit64::ps_res(UGeckoInstruction inst)
   FALLBACK_IF(jo.fp_exceptions || jo.div_by_zero_exceptions);
   int b = inst.FB;
   int d = inst.FD;
+  // Only one call is needed if both halves of b are known to be equal, as in ps_rsqrte.
+  bool duplicated = js.op->fprIsDuplicated[b];
 
   RCX64Reg scratch_guard = gpr.Scratch(RSCRATCH_EXTRA);
   RCX64Reg Rb = fpr.Bind(b, RCMode::Read);
@@ -189,11 +201,18 @@ void Jit64::ps_res(UGeckoInstruction inst)
 
   MOVSD(XMM0, Rb);
   CALL(asm_routines.fres);
-  MOVSD(Rd, XMM0);
+  if (duplicated)
+  {
+    MOVDDUP(Rd, R(XMM0));
+  }
+  else
+  {
+    MOVSD(Rd, XMM0);
 
-  MOVHLPS(XMM0, Rb);
-  CALL(asm_routines.fres);
-  MOVLHPS(Rd, XMM0);
+    MOVHLPS(XMM0, Rb);
+    CALL(asm_routines.fres);
+    MOVLHPS(Rd, XMM0);
+  }
 
   FinalizeSingleResult(Rd, Rd);
 }
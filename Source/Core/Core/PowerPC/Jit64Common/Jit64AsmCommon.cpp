@@ -222,8 +222,9 @@ void CommonAsmRoutines::GenFres()
   // This function clobbers all three RSCRATCH.
   MOVQ_xmm(R(RSCRATCH), XMM0);
 
-  // Zero inputs set an exception and take the complex path.
-  TEST(64, R(RSCRATCH), R(RSCRATCH));
+  // Zero inputs (of either sign) set an exception and take the complex path.
+  MOV(64, R(RSCRATCH2), R(RSCRATCH));
+  SHL(64, R(RSCRATCH2), Imm8(1));
   FixupBranch zero = J_CC(CC_Z);
 
   MOV(64, R(RSCRATCH_EXTRA), R(RSCRATCH));
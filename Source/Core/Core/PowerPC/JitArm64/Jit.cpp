@@ -372,18 +372,16 @@ void JitArm64::ResetStack()
 void JitArm64::IntializeSpeculativeConstants()
 {
   // If the block depends on an input register which looks like a gather pipe or MMIO related
-  // constant, guess that it is actually a constant input, and specialize the block based on this
-  // assumption. This happens when there are branches in code writing to the gather pipe, but only
-  // the first block loads the constant.
+  // constant, or a small data area base pointer, guess that it is actually a constant input, and
+  // specialize the block based on this assumption. This happens when there are branches in code
+  // writing to the gather pipe, but only the first block loads the constant.
   // Insert a check at the start of the block to verify that the value is actually constant.
   // This can save a lot of backpatching and optimize gather pipe writes in more places.
   const u8* fail = nullptr;
   for (auto i : code_block.m_gpr_inputs)
   {
     u32 compile_time_value = m_ppc_state.gpr[i];
-    if (m_mmu.IsOptimizableGatherPipeWrite(compile_time_value) ||
-        m_mmu.IsOptimizableGatherPipeWrite(compile_time_value - 0x8000) ||
-        compile_time_value == 0xCC000000)
+    if (IsSpeculativeConstant(i, compile_time_value))
     {
       if (!fail)
       {
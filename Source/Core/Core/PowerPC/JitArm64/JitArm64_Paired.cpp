@@ -431,6 +431,9 @@ void JitArm64::ps_res(UGeckoInstruction inst)
 
   const u32 b = inst.FB;
   const u32 d = inst.FD;
+  // A duplicated input has a duplicated estimate, and estimating the same value again wouldn't
+  // change any FPSCR flags, so one call is enough.
+  const bool duplicated = js.op->fprIsDuplicated[b];
 
   gpr.Lock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W3, ARM64Reg::W4, ARM64Reg::W30);
   fpr.Lock(ARM64Reg::Q0);
@@ -441,11 +444,19 @@ void JitArm64::ps_res(UGeckoInstruction inst)
   m_float_emit.FMOV(ARM64Reg::X1, EncodeRegToDouble(VB));
   m_float_emit.FRECPE(64, ARM64Reg::Q0, EncodeRegToQuad(VB));
   BL(GetAsmRoutines()->fres);
-  m_float_emit.UMOV(64, ARM64Reg::X1, EncodeRegToQuad(VB), 1);
-  m_float_emit.DUP(64, ARM64Reg::Q0, ARM64Reg::Q0, 1);
-  m_float_emit.FMOV(EncodeRegToDouble(VD), ARM64Reg::X0);
-  BL(GetAsmRoutines()->fres);
-  m_float_emit.INS(64, EncodeRegToQuad(VD), 1, ARM64Reg::X0);
+  if (duplicated)
+  {
+    m_float_emit.FMOV(EncodeRegToDouble(VD), ARM64Reg::X0);
+    m_float_emit.DUP(64, EncodeRegToQuad(VD), EncodeRegToQuad(VD), 0);
+  }
+  else
+  {
+    m_float_emit.UMOV(64, ARM64Reg::X1, EncodeRegToQuad(VB), 1);
+    m_float_emit.DUP(64, ARM64Reg::Q0, ARM64Reg::Q0, 1);
+    m_float_emit.FMOV(EncodeRegToDouble(VD), ARM64Reg::X0);
+    BL(GetAsmRoutines()->fres);
+    m_float_emit.INS(64, EncodeRegToQuad(VD), 1, ARM64Reg::X0);
+  }
 
   gpr.Unlock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W3, ARM64Reg::W4, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
@@ -464,6 +475,8 @@ void JitArm64::ps_rsqrte(UGeckoInstruction inst)
 
   const u32 b = inst.FB;
   const u32 d = inst.FD;
+  // See ps_res
+  const bool duplicated = js.op->fprIsDuplicated[b];
 
   gpr.Lock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W3, ARM64Reg::W30);
   fpr.Lock(ARM64Reg::Q0);
@@ -474,11 +487,19 @@ void JitArm64::ps_rsqrte(UGeckoInstruction inst)
   m_float_emit.FMOV(ARM64Reg::X1, EncodeRegToDouble(VB));
   m_float_emit.FRSQRTE(64, ARM64Reg::Q0, EncodeRegToQuad(VB));
   BL(GetAsmRoutines()->frsqrte);
-  m_float_emit.UMOV(64, ARM64Reg::X1, EncodeRegToQuad(VB), 1);
-  m_float_emit.DUP(64, ARM64Reg::Q0, ARM64Reg::Q0, 1);
-  m_float_emit.FMOV(EncodeRegToDouble(VD), ARM64Reg::X0);
-  BL(GetAsmRoutines()->frsqrte);
-  m_float_emit.INS(64, EncodeRegToQuad(VD), 1, ARM64Reg::X0);
+  if (duplicated)
+  {
+    m_float_emit.FMOV(EncodeRegToDouble(VD), ARM64Reg::X0);
+    m_float_emit.DUP(64, EncodeRegToQuad(VD), EncodeRegToQuad(VD), 0);
+  }
+  else
+  {
+    m_float_emit.UMOV(64, ARM64Reg::X1, EncodeRegToQuad(VB), 1);
+    m_float_emit.DUP(64, ARM64Reg::Q0, ARM64Reg::Q0, 1);
+    m_float_emit.FMOV(EncodeRegToDouble(VD), ARM64Reg::X0);
+    BL(GetAsmRoutines()->frsqrte);
+    m_float_emit.INS(64, EncodeRegToQuad(VD), 1, ARM64Reg::X0);
+  }
 
   gpr.Unlock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W3, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
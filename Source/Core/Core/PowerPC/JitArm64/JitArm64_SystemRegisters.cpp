@@ -295,6 +295,8 @@ void JitArm64::mtsr(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITSystemRegistersOff);
+  // The MMU has to drop the fastmem mappings it made based on the old segment
+  FALLBACK_IF(jo.fastmem_arena);
 
   STR(IndexType::Unsigned, gpr.R(inst.RS), PPC_REG, PPCSTATE_OFF_SR(inst.SR));
 }
@@ -321,6 +323,7 @@ void JitArm64::mtsrin(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITSystemRegistersOff);
+  FALLBACK_IF(jo.fastmem_arena);
 
   u32 b = inst.RB, d = inst.RD;
   gpr.BindToRegister(d, d == b);
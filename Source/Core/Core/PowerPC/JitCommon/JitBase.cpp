@@ -57,7 +57,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -74,6 +74,7 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_likely_branch_following, &Config::MAIN_JIT_FOLLOW_LIKELY_BRANCH},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
@@ -131,6 +132,8 @@ void JitBase::RefreshConfig()
 
   analyzer.SetDebuggingEnabled(m_enable_debugging);
   analyzer.SetBranchFollowingEnabled(m_enable_branch_following);
+  analyzer.SetLikelyTakenBranches(
+      m_enable_likely_branch_following ? &js.likelyTakenBranchAddresses : nullptr);
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
 
@@ -276,6 +279,22 @@ bool JitBase::CanMergeNextInstructions(int count) const
   return true;
 }
 
+bool JitBase::IsSpeculativeConstant(size_t reg, u32 value) const
+{
+  // Gather pipe and MMIO addresses, which code often computes once and then reuses across blocks.
+  if (m_mmu.IsOptimizableGatherPipeWrite(value) ||
+      m_mmu.IsOptimizableGatherPipeWrite(value - 0x8000) || value == 0xCC000000)
+  {
+    return true;
+  }
+
+  // The small data area base pointers of the EABI, which are set up once by the runtime and then
+  // used by most accesses to global variables. Turning them into constants saves reloading them
+  // from PowerPCState in every block and lets the address of those accesses be computed at compile
+  // time.
+  return (reg == 2 || reg == 13) && value != 0;
+}
+
 bool JitBase::ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const
 {
   if (jo.fp_exceptions)
@@ -130,6 +130,7 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_set<u32> likelyTakenBranchAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -153,6 +154,7 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_likely_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -165,7 +167,7 @@ protected:
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -188,6 +190,7 @@ protected:
   }
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const;
+  bool IsSpeculativeConstant(size_t reg, u32 value) const;
 
 public:
   explicit JitBase(Core::System& system);
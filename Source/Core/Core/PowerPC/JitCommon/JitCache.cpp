@@ -15,6 +15,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
+#include "Common/Logging/Log.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/Host.h"
@@ -83,6 +84,9 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.likelyTakenBranchAddresses.clear();
+  m_pending_invalidations.clear();
+  m_has_pending_invalidations = false;
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -132,6 +136,9 @@ void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
+  // Don't let the new block link to blocks which are about to be destroyed
+  FlushPendingInvalidations();
+
   const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
   JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
   b.effectiveAddress = em_address;
@@ -171,6 +178,11 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                  original_buffer_transform_view.end());
   }
 
+  block.idle_loop = std::ranges::any_of(std::span{code_buffer.data(), block.originalSize},
+                                        &PPCAnalyst::CodeOp::branchIsIdleLoop);
+  if (block.idle_loop)
+    DEBUG_LOG_FMT(DYNA_REC, "Detected idle loop at {:08x}", block.effectiveAddress);
+
   for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
@@ -328,7 +340,10 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
   if (destroy_block)
   {
     // destroy JIT blocks
+    const auto erase_start = std::chrono::steady_clock::now();
     ErasePhysicalRange(physical_address, length);
+    m_invalidation_stats.erased_ranges++;
+    m_invalidation_stats.erase_time += std::chrono::steady_clock::now() - erase_start;
 
     // If the code was actually modified, we need to clear the relevant entries from the
     // FIFO write address cache, so we don't end up with FIFO checks in places they shouldn't
@@ -341,11 +356,87 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.likelyTakenBranchAddresses.erase(i);
       }
     }
   }
 }
 
+void JitBaseBlockCache::QueueICacheLineInvalidation(u32 address)
+{
+  if (!m_defer_invalidations || m_jit.IsDebuggingEnabled())
+  {
+    InvalidateICacheLine(address);
+    return;
+  }
+
+  const u32 cache_line_address = address & ~0x1f;
+  const auto translated = m_jit.m_mmu.JitCache_TranslateAddress(cache_line_address);
+  if (!translated.valid || !valid_block.Test(translated.address / 32))
+    return;
+
+  m_invalidation_stats.queued_lines++;
+
+  // Merge the line into the pending ranges, which are sorted by effective address. A range only
+  // grows by lines that are contiguous in both address spaces.
+  const auto next = m_pending_invalidations.upper_bound(cache_line_address);
+  const bool joins_next = next != m_pending_invalidations.end() &&
+                          next->first == cache_line_address + 32 &&
+                          next->second.physical_address == translated.address + 32;
+  if (next != m_pending_invalidations.begin())
+  {
+    const auto previous = std::prev(next);
+    PendingInvalidation& invalidation = previous->second;
+    const u32 offset = cache_line_address - previous->first;
+    const bool contiguous = translated.address - invalidation.physical_address == offset;
+    if (offset < invalidation.length)
+    {
+      // Already pending, unless the line has been mapped elsewhere since
+      if (!contiguous)
+        InvalidateICacheLine(address);
+      return;
+    }
+    if (offset == invalidation.length && contiguous)
+    {
+      invalidation.length += 32;
+      if (joins_next)
+      {
+        invalidation.length += next->second.length;
+        m_pending_invalidations.erase(next);
+      }
+      return;
+    }
+  }
+
+  PendingInvalidation invalidation{translated.address, 32};
+  if (joins_next)
+  {
+    invalidation.length += next->second.length;
+    m_pending_invalidations.erase(next);
+  }
+  m_pending_invalidations.emplace(cache_line_address, invalidation);
+  m_has_pending_invalidations = true;
+
+  // Code which keeps invalidating scattered lines without ever executing isync still has to see
+  // its changes eventually.
+  constexpr size_t MAX_PENDING_INVALIDATIONS = 256;
+  if (m_pending_invalidations.size() >= MAX_PENDING_INVALIDATIONS)
+    FlushPendingInvalidations();
+}
+
+void JitBaseBlockCache::FlushPendingInvalidations()
+{
+  if (!m_has_pending_invalidations)
+    return;
+
+  for (const auto& [address, invalidation] : m_pending_invalidations)
+    InvalidateICacheInternal(invalidation.physical_address, address, invalidation.length, false);
+
+  m_pending_invalidations.clear();
+  m_has_pending_invalidations = false;
+  m_invalidation_stats.sweeps++;
+}
+
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
   // Iterate over all macro blocks which overlap the given range.
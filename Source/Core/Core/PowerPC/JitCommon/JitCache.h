@@ -103,6 +103,9 @@ struct JitBlock : public JitBlockData
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
+  // Whether the block ends in a busy wait loop which is skipped by idling until the next event
+  bool idle_loop = false;
+
   // This is only available when debugging is enabled. It is a trimmed-down copy of the
   // PPCAnalyst::CodeBuffer used to recompile this block, including repeat instructions.
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
@@ -142,6 +145,16 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+struct JitInvalidationStats
+{
+  // Cache lines whose invalidation was deferred, and the sweeps which applied them
+  u64 queued_lines = 0;
+  u64 sweeps = 0;
+  // Invalidations which had to look for blocks to destroy, and the time spent doing so
+  u64 erased_ranges = 0;
+  std::chrono::nanoseconds erase_time{};
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -186,6 +199,15 @@ public:
   void ErasePhysicalRange(u32 address, u32 length);
   void EraseSingleBlock(const JitBlock& block);
 
+  // icbi only has to take effect once isync has been executed, so a JIT which applies pending
+  // invalidations on isync can let those of a whole icbi loop pile up and apply them in one sweep.
+  // Adjacent cache lines are coalesced into a single range.
+  void SetDeferInvalidations(bool defer) { m_defer_invalidations = defer; }
+  void QueueICacheLineInvalidation(u32 address);
+  void FlushPendingInvalidations();
+  const bool* GetPendingInvalidationsFlag() const { return &m_has_pending_invalidations; }
+  const JitInvalidationStats& GetInvalidationStats() const { return m_invalidation_stats; }
+
   u32* GetBlockBitSet() const;
 
 protected:
@@ -235,4 +257,15 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  struct PendingInvalidation
+  {
+    u32 physical_address;
+    u32 length;
+  };
+  // Effective start address -> range
+  std::map<u32, PendingInvalidation> m_pending_invalidations;
+  bool m_has_pending_invalidations = false;
+  bool m_defer_invalidations = false;
+  JitInvalidationStats m_invalidation_stats;
 };
@@ -300,6 +300,30 @@ void JitInterface::InvalidateICacheLinesFromJIT(JitInterface& jit_interface, u32
   jit_interface.InvalidateICacheLines(address, count);
 }
 
+void JitInterface::QueueICacheLineInvalidation(u32 address)
+{
+  if (m_jit)
+    m_jit->GetBlockCache()->QueueICacheLineInvalidation(address);
+}
+
+void JitInterface::FlushPendingICacheInvalidations()
+{
+  if (m_jit)
+    m_jit->GetBlockCache()->FlushPendingInvalidations();
+}
+
+void JitInterface::FlushPendingICacheInvalidationsFromJIT(JitInterface& jit_interface)
+{
+  jit_interface.FlushPendingICacheInvalidations();
+}
+
+JitInvalidationStats JitInterface::GetInvalidationStats() const
+{
+  if (m_jit)
+    return m_jit->GetBlockCache()->GetInvalidationStats();
+  return {};
+}
+
 void JitInterface::CompileExceptionCheck(ExceptionType type)
 {
   if (!m_jit)
@@ -347,6 +371,21 @@ void JitInterface::CompileExceptionCheckFromJIT(JitInterface& jit_interface, Exc
   jit_interface.CompileExceptionCheck(type);
 }
 
+void JitInterface::CompileLikelyTakenBranch(u32 address)
+{
+  if (!m_jit || !m_jit->js.likelyTakenBranchAddresses.insert(address).second)
+    return;
+
+  // Invalidate the JIT blocks containing the branch so that they get recompiled as a trace
+  // following it.
+  m_jit->GetBlockCache()->InvalidateICache(address, 4, true);
+}
+
+void JitInterface::CompileLikelyTakenBranchFromJIT(JitInterface& jit_interface, u32 address)
+{
+  jit_interface.CompileLikelyTakenBranch(address);
+}
+
 void JitInterface::Shutdown()
 {
   if (m_jit)
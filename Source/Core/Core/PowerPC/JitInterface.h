@@ -19,6 +19,7 @@ class CPUCoreBase;
 class PointerWrap;
 class JitBase;
 struct JitBlock;
+struct JitInvalidationStats;
 
 namespace Core
 {
@@ -83,6 +84,13 @@ public:
   static void InvalidateICacheLineFromJIT(JitInterface& jit_interface, u32 address);
   static void InvalidateICacheLinesFromJIT(JitInterface& jit_interface, u32 address, u32 count);
 
+  // Used by icbi. The invalidation may be deferred until FlushPendingICacheInvalidations, which
+  // happens on isync, before compiling new blocks, and at the end of each timeslice.
+  void QueueICacheLineInvalidation(u32 address);
+  void FlushPendingICacheInvalidations();
+  static void FlushPendingICacheInvalidationsFromJIT(JitInterface& jit_interface);
+  JitInvalidationStats GetInvalidationStats() const;
+
   enum class ExceptionType
   {
     FIFOWrite,
@@ -92,6 +100,11 @@ public:
   void CompileExceptionCheck(ExceptionType type);
   static void CompileExceptionCheckFromJIT(JitInterface& jit_interface, ExceptionType type);
 
+  // Recompiles the blocks containing the conditional branch at the given address so that they
+  // continue at its target
+  void CompileLikelyTakenBranch(u32 address);
+  static void CompileLikelyTakenBranchFromJIT(JitInterface& jit_interface, u32 address);
+
   /// used for the page fault unit test, don't use outside of tests!
   void SetJit(std::unique_ptr<JitBase> jit);
 
@@ -1335,6 +1335,10 @@ void MMU::SDRUpdated()
 
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+  m_page_table_cache.Clear();
+#ifndef _ARCH_32
+  m_memory.ClearPageTableTranslations();
+#endif
 }
 
 enum class TLBLookupResult
@@ -1424,6 +1428,20 @@ void MMU::InvalidateTLBEntry(u32 address)
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+  m_page_table_cache.Invalidate(EffectiveAddress{address}.page_index);
+
+#ifndef _ARCH_32
+  // Like the TLB entries, this has to cover every page that tlbie invalidates on real hardware,
+  // which is all pages in the same congruence class, in every segment
+  m_memory.UnmapPageTableTranslationsInTLBSet(entry_index);
+#endif
+}
+
+void MMU::SRUpdated(u32 index)
+{
+#ifndef _ARCH_32
+  m_memory.UnmapPageTableTranslations(index << 28, 0x10000000);
+#endif
 }
 
 // Page Address Translation
@@ -1460,70 +1478,105 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   const u32 page_index = address.page_index;  // 16 bit
   const u32 api = address.API;                //  6 bit (part of page_index)
 
-  // hash function no 1 "xor" .360
-  u32 hash = (VSID ^ page_index);
+  constexpr XCheckTLBFlag pte_read_flag =
+      IsNoExceptionFlag(flag) ? XCheckTLBFlag::NoException : XCheckTLBFlag::Read;
 
-  UPTE_Lo pte1;
-  pte1.VSID = VSID;
-  pte1.API = api;
-  pte1.V = 1;
-
-  for (int hash_func = 0; hash_func < 2; hash_func++)
+  u32 pte2_addr = 0;
+  UPTE_Hi pte2;
+  if (const PageTableCache::Entry* entry = m_page_table_cache.Lookup(VSID, page_index))
   {
-    // hash function no 2 "not" .360
-    if (hash_func == 1)
+    // Skip walking the page table if we've found this entry before, and it's still there
+    if (ReadFromHardware<pte_read_flag, u32, true>(entry->pte_address - 4) == entry->pte1)
     {
-      hash = ~hash;
-      pte1.H = 1;
+      pte2_addr = entry->pte_address;
+      pte2.Hex = ReadFromHardware<pte_read_flag, u32, true>(pte2_addr);
     }
+  }
 
-    u32 pteg_addr = ((hash & m_ppc_state.pagetable_hashmask) << 6) | m_ppc_state.pagetable_base;
+  if (pte2_addr == 0)
+  {
+    // hash function no 1 "xor" .360
+    u32 hash = (VSID ^ page_index);
 
-    for (int i = 0; i < 8; i++, pteg_addr += 8)
+    UPTE_Lo pte1;
+    pte1.VSID = VSID;
+    pte1.API = api;
+    pte1.V = 1;
+
+    for (int hash_func = 0; hash_func < 2 && pte2_addr == 0; hash_func++)
     {
-      constexpr XCheckTLBFlag pte_read_flag =
-          IsNoExceptionFlag(flag) ? XCheckTLBFlag::NoException : XCheckTLBFlag::Read;
-      const u32 pteg = ReadFromHardware<pte_read_flag, u32, true>(pteg_addr);
+      // hash function no 2 "not" .360
+      if (hash_func == 1)
+      {
+        hash = ~hash;
+        pte1.H = 1;
+      }
+
+      u32 pteg_addr = ((hash & m_ppc_state.pagetable_hashmask) << 6) | m_ppc_state.pagetable_base;
 
-      if (pte1.Hex == pteg)
+      for (int i = 0; i < 8; i++, pteg_addr += 8)
       {
-        UPTE_Hi pte2(ReadFromHardware<pte_read_flag, u32, true>(pteg_addr + 4));
+        const u32 pteg = ReadFromHardware<pte_read_flag, u32, true>(pteg_addr);
 
-        // set the access bits
-        switch (flag)
+        if (pte1.Hex == pteg)
         {
-        case XCheckTLBFlag::NoException:
-        case XCheckTLBFlag::OpcodeNoException:
-          break;
-        case XCheckTLBFlag::Read:
-          pte2.R = 1;
-          break;
-        case XCheckTLBFlag::Write:
-          pte2.R = 1;
-          pte2.C = 1;
-          break;
-        case XCheckTLBFlag::Opcode:
-          pte2.R = 1;
+          pte2_addr = pteg_addr + 4;
+          pte2.Hex = ReadFromHardware<pte_read_flag, u32, true>(pte2_addr);
           break;
         }
+      }
+    }
 
-        if (!IsNoExceptionFlag(flag))
-        {
-          m_memory.Write_U32(pte2.Hex, pteg_addr + 4);
-        }
+    if (pte2_addr == 0)
+      return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
 
-        // We already updated the TLB entry if this was caused by a C bit.
-        if (res != TLBLookupResult::UpdateC)
-          UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+    m_page_table_cache.Insert(VSID, page_index, pte2_addr, pte1.Hex);
+  }
 
-        *wi = (pte2.WIMG & 0b1100) != 0;
+  // set the access bits
+  switch (flag)
+  {
+  case XCheckTLBFlag::NoException:
+  case XCheckTLBFlag::OpcodeNoException:
+    break;
+  case XCheckTLBFlag::Read:
+    pte2.R = 1;
+    break;
+  case XCheckTLBFlag::Write:
+    pte2.R = 1;
+    pte2.C = 1;
+    break;
+  case XCheckTLBFlag::Opcode:
+    pte2.R = 1;
+    break;
+  }
 
-        return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
-                                      (pte2.RPN << 12) | offset};
-      }
-    }
+  if (!IsNoExceptionFlag(flag))
+  {
+    m_memory.Write_U32(pte2.Hex, pte2_addr);
+  }
+
+#ifndef _ARCH_32
+  // Once R and C are both set, accesses no longer have side effects on the page table, so the
+  // page can be accessed through fastmem like BAT-mapped memory. Uncached memory and memchecks
+  // are left to the slow path for the same reasons as in UpdateBATs.
+  if ((flag == XCheckTLBFlag::Read || flag == XCheckTLBFlag::Write) && pte2.R && pte2.C &&
+      (pte2.WIMG & 0b1100) == 0)
+  {
+    const u32 page_address = address.Hex & ~u32(HW_PAGE_MASK);
+    if (!m_power_pc.GetMemChecks().OverlapsMemcheck(page_address, HW_PAGE_SIZE))
+      m_memory.MapPageTableTranslation(page_address, pte2.RPN << HW_PAGE_INDEX_SHIFT);
   }
-  return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
+#endif
+
+  // We already updated the TLB entry if this was caused by a C bit.
+  if (res != TLBLookupResult::UpdateC)
+    UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+
+  *wi = (pte2.WIMG & 0b1100) != 0;
+
+  return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
+                                (pte2.RPN << 12) | offset};
 }
 
 void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
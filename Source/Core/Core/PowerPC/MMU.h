@@ -10,6 +10,7 @@
 
 #include "Common/BitField.h"
 #include "Common/CommonTypes.h"
+#include "Core/PowerPC/PageTableCache.h"
 
 namespace Core
 {
@@ -239,6 +240,11 @@ public:
   // TLB functions
   void SDRUpdated();
   void InvalidateTLBEntry(u32 address);
+  // Must be called after writing to a segment register
+  void SRUpdated(u32 index);
+  void ClearPageTableCache() { m_page_table_cache.Clear(); }
+  const PageTableCache& GetPageTableCache() const { return m_page_table_cache; }
+  void ResetPageTableCacheCounters() { m_page_table_cache.ResetCounters(); }
   void DBATUpdated();
   void IBATUpdated();
 
@@ -327,6 +333,8 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  PageTableCache m_page_table_cache;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
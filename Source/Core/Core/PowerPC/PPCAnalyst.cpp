@@ -737,13 +737,27 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
+static bool IsMemoryBarrier(const CodeOp& op)
+{
+  // sync, eieio and isync don't change any state the loop could depend on
+  if (op.inst.OPCD == 31)
+    return op.inst.SUBOP10 == 598 || op.inst.SUBOP10 == 854;
+  return op.inst.OPCD == 19 && op.inst.SUBOP10 == 150;
+}
+
+static bool IsConditionRegisterLogical(const CodeOp& op)
+{
+  // crand etc., and mcrf
+  return op.opinfo->type == OpType::CR || (op.inst.OPCD == 19 && op.inst.SUBOP10 == 0);
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
   //   * It loops to itself and does not contain any other branches.
   //   * It does not write to memory.
   //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //     does not write to these registers. CR fields are treated the same way.
   //
   // Would benefit a lot from basic inlining support - a lot of the most
   // used busy loops are DSP register interactions, which are bl/cmp/bne
@@ -751,8 +765,16 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
   // don't detect these at the moment.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  BitSet8 write_disallowed_cr;
+  BitSet8 written_cr;
   for (size_t i = 0; i <= instructions; ++i)
   {
+    // Polling loops often combine several conditions with CR logical instructions before branching
+    write_disallowed_cr |= code[i].crIn & ~written_cr;
+    if (code[i].crOut & write_disallowed_cr)
+      return false;
+    written_cr |= code[i].crOut;
+
     if (code[i].opinfo->type == OpType::Branch)
     {
       if (code[i].branchUsesCtr)
@@ -760,7 +782,13 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (IsMemoryBarrier(code[i]))
+    {
+      // MMIO polling loops tend to contain these
+      continue;
+    }
+    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load &&
+             !IsConditionRegisterLogical(code[i]))
     {
       // In the future, some subsets of other instruction types might get
       // supported. Right now, only try loops that have this very
@@ -945,6 +973,18 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
 
+    if (conditional_continue && enable_follow && HasOption(OPTION_LIKELY_BRANCH_FOLLOW) &&
+        m_likely_taken_branches && !m_is_debugging_enabled && inst.OPCD == 16 && !inst.LK &&
+        code[i].branchTo != block->m_address && numFollows < BRANCH_FOLLOWING_THRESHOLD &&
+        m_likely_taken_branches->contains(address))
+    {
+      // Continue the block at the target of a conditional branch which is usually taken, so that
+      // registers stay allocated along the hot path. The JIT exits the block if it isn't taken.
+      code[i].branchIsLikelyTaken = true;
+      follow = true;
+      found_call = false;
+    }
+
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
       // Follow the unconditional branch.
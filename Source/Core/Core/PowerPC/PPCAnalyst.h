@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -40,6 +41,9 @@ struct CodeOp  // 16B
   BitSet8 crOut;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  // conditional branch which was followed because it is usually taken; the block is left when the
+  // branch is not taken instead
+  bool branchIsLikelyTaken = false;
   BitSet8 wantsCR;
   bool wantsFPRF = false;
   bool wantsCA = false;
@@ -171,6 +175,11 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Follow conditional branches which the JIT has observed to be usually taken,
+    // forming a trace along the hot path. The not-taken path becomes an exit.
+    // Requires OPTION_CONDITIONAL_CONTINUE and JIT support.
+    OPTION_LIKELY_BRANCH_FOLLOW = (1 << 7),
   };
 
   // Option setting/getting
@@ -179,6 +188,11 @@ public:
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
+  // Addresses of conditional branches to follow, or nullptr to not follow any
+  void SetLikelyTakenBranches(const std::unordered_set<u32>* addresses)
+  {
+    m_likely_taken_branches = addresses;
+  }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
@@ -203,6 +217,7 @@ private:
 
   bool m_is_debugging_enabled = false;
   bool m_enable_branch_following = false;
+  const std::unordered_set<u32>* m_likely_taken_branches = nullptr;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
 };
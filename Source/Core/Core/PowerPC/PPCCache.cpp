@@ -386,8 +386,7 @@ u32 InstructionCache::ReadInstruction(Memory::MemoryManager& memory,
   return Common::swap32(value);
 }
 
-void InstructionCache::Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface,
-                                  u32 addr)
+void InstructionCache::InvalidateSet(Memory::MemoryManager& memory, u32 addr)
 {
   // Per the 750cl manual, section 3.4.1.5 Instruction Cache Enabling/Disabling (page 137)
   // and section 3.4.2.6 Instruction Cache Block Invalidate (icbi) (page 140), the icbi
@@ -410,11 +409,24 @@ void InstructionCache::Invalidate(Memory::MemoryManager& memory, JitInterface& j
   }
   valid[set] = 0;
   modified[set] = 0;
+}
+
+void InstructionCache::Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface,
+                                  u32 addr)
+{
+  InvalidateSet(memory, addr);
 
   // Also tell the JIT that the corresponding address has been invalidated
   jit_interface.InvalidateICacheLine(addr);
 }
 
+void InstructionCache::InvalidateFromICBI(Memory::MemoryManager& memory,
+                                          JitInterface& jit_interface, u32 addr)
+{
+  InvalidateSet(memory, addr);
+  jit_interface.QueueICacheLineInvalidation(addr);
+}
+
 void InstructionCache::RefreshConfig()
 {
   m_disable_icache = Config::Get(Config::MAIN_DISABLE_ICACHE);
@@ -79,8 +79,14 @@ struct InstructionCache : public Cache
   ~InstructionCache();
   u32 ReadInstruction(Memory::MemoryManager& memory, PowerPC::PowerPCState& ppc_state, u32 addr);
   void Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface, u32 addr);
+  // Used by icbi, which only has to take effect once isync has been executed, so the JIT may
+  // destroy the blocks in the line later on
+  void InvalidateFromICBI(Memory::MemoryManager& memory, JitInterface& jit_interface, u32 addr);
   void Init(Memory::MemoryManager& memory);
   void Reset(JitInterface& jit_interface);
   void RefreshConfig();
+
+private:
+  void InvalidateSet(Memory::MemoryManager& memory, u32 addr);
 };
 }  // namespace PowerPC
@@ -0,0 +1,82 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+
+namespace PowerPC
+{
+// Host-side cache of where the page table entries found by walking the hashed page table are,
+// consulted when the emulated TLB misses. Entries are tagged with the virtual page (VSID and page
+// index) they translate, so segment register changes don't need to invalidate anything.
+//
+// Like the TLB, this relies on tlbie and SDR1 writes to drop what it knows. Both words of the entry
+// are still read from the page table again on every hit, so an entry that software rewrites or
+// removes without tlbie is noticed too.
+class PageTableCache
+{
+public:
+  static constexpr u32 NUM_ENTRIES = 4096;
+
+  struct Entry
+  {
+    static constexpr u32 INVALID_VSID = 0xffffffff;
+
+    u32 vsid = INVALID_VSID;
+    u32 page_index = 0;
+    // Physical address of the second word of the page table entry
+    u32 pte_address = 0;
+    // The first word the page table entry had, which is rechecked on every hit
+    u32 pte1 = 0;
+  };
+
+  // Returns nullptr if the translation isn't cached. Lookups of entries which turn out to be stale
+  // are counted as hits.
+  const Entry* Lookup(u32 vsid, u32 page_index)
+  {
+    Entry& entry = m_entries[page_index % NUM_ENTRIES];
+    if (entry.vsid != vsid || entry.page_index != page_index)
+    {
+      m_misses++;
+      return nullptr;
+    }
+    m_hits++;
+    return &entry;
+  }
+
+  void Insert(u32 vsid, u32 page_index, u32 pte_address, u32 pte1)
+  {
+    m_entries[page_index % NUM_ENTRIES] = {vsid, page_index, pte_address, pte1};
+  }
+
+  // tlbie invalidates all page indices in the congruence class of the given one, i.e. which share
+  // its low 6 bits, in all segments
+  void Invalidate(u32 page_index)
+  {
+    for (u32 i = page_index % TLB_SETS; i < NUM_ENTRIES; i += TLB_SETS)
+      m_entries[i] = {};
+  }
+
+  void Clear() { m_entries.fill({}); }
+
+  u64 GetHits() const { return m_hits; }
+  u64 GetMisses() const { return m_misses; }
+  void ResetCounters()
+  {
+    m_hits = 0;
+    m_misses = 0;
+  }
+
+private:
+  // The number of congruence classes of the TLB, which is also HW_PAGE_INDEX_MASK + 1
+  static constexpr u32 TLB_SETS = 64;
+  static_assert(NUM_ENTRIES % TLB_SETS == 0);
+
+  std::array<Entry, NUM_ENTRIES> m_entries{};
+  u64 m_hits = 0;
+  u64 m_misses = 0;
+};
+}  // namespace PowerPC
@@ -62,7 +62,7 @@ static void InvalidateCacheThreadSafe(Core::System& system, u64 userdata, s64 cy
 
 PowerPCManager::PowerPCManager(Core::System& system)
     : m_breakpoints(system), m_memchecks(system), m_debug_interface(system, m_symbol_db),
-      m_system(system)
+      m_guest_profiler(system), m_system(system)
 {
 }
 
@@ -119,8 +119,11 @@ void PowerPCManager::DoState(PointerWrap& p)
     auto& mmu = m_system.GetMMU();
     mmu.IBATUpdated();
     mmu.DBATUpdated();
+    mmu.ClearPageTableCache();
   }
 
+  m_guest_profiler.DoState(p);
+
   // SystemTimers::DecrementerSet();
   // SystemTimers::TimeBaseSet();
 
@@ -264,6 +267,7 @@ void PowerPCManager::Init(CPUCore cpu_core)
 
   m_invalidate_cache_thread_safe =
       m_system.GetCoreTiming().RegisterEvent("invalidateEmulatedCache", InvalidateCacheThreadSafe);
+  m_guest_profiler.Init();
 
   Reset();
 
@@ -278,6 +282,7 @@ void PowerPCManager::Reset()
   m_ppc_state.pagetable_base = 0;
   m_ppc_state.pagetable_hashmask = 0;
   m_ppc_state.tlb = {};
+  m_system.GetMMU().ClearPageTableCache();
 
   ResetRegisters();
   m_ppc_state.iCache.Reset(m_system.GetJitInterface());
@@ -303,6 +308,12 @@ void PowerPCManager::ScheduleInvalidateCacheThreadSafe(u32 address)
 
 void PowerPCManager::Shutdown()
 {
+  auto& mmu = m_system.GetMMU();
+  const PageTableCache& page_table_cache = mmu.GetPageTableCache();
+  INFO_LOG_FMT(POWERPC, "Page table cache: {} hits, {} misses", page_table_cache.GetHits(),
+               page_table_cache.GetMisses());
+  mmu.ResetPageTableCacheCounters();
+
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
   InjectExternalCPUCore(nullptr);
   m_system.GetJitInterface().Shutdown();
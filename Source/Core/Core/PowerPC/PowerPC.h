@@ -14,6 +14,7 @@
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Debugger/BranchWatch.h"
+#include "Core/Debugger/GuestProfiler.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/ConditionRegister.h"
@@ -302,6 +303,8 @@ public:
   const PPCSymbolDB& GetSymbolDB() const { return m_symbol_db; }
   Core::BranchWatch& GetBranchWatch() { return m_branch_watch; }
   const Core::BranchWatch& GetBranchWatch() const { return m_branch_watch; }
+  Core::GuestProfiler& GetGuestProfiler() { return m_guest_profiler; }
+  const Core::GuestProfiler& GetGuestProfiler() const { return m_guest_profiler; }
 
 private:
   void InitializeCPUCore(CPUCore cpu_core);
@@ -320,6 +323,7 @@ private:
   PPCSymbolDB m_symbol_db;
   PPCDebugInterface m_debug_interface;
   Core::BranchWatch m_branch_watch;
+  Core::GuestProfiler m_guest_profiler;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
 
@@ -60,6 +60,8 @@ void AdvancedWidget::CreateWidgets()
   m_show_speed = new ConfigBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED, m_game_layer);
   m_show_speed_colors =
       new ConfigBool(tr("Show Speed Colors"), Config::GFX_SHOW_SPEED_COLORS, m_game_layer);
+  m_show_audio_latency =
+      new ConfigBool(tr("Show Audio Latency"), Config::GFX_SHOW_AUDIO_LATENCY, m_game_layer);
   m_perf_samp_window = new ConfigInteger(0, 10000, Config::GFX_PERF_SAMP_WINDOW, m_game_layer, 100);
   m_perf_samp_window->SetTitle(tr("Performance Sample Window (ms)"));
   m_log_render_time = new ConfigBool(tr("Log Render Time to File"),
@@ -75,6 +77,7 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_audio_latency, 5, 0);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -222,9 +225,12 @@ void AdvancedWidget::CreateWidgets()
       tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION, m_game_layer);
   m_manual_texture_sampling = new ConfigBool(
       tr("Manual Texture Sampling"), Config::GFX_HACK_FAST_TEXTURE_SAMPLING, m_game_layer, true);
+  m_display_list_cache =
+      new ConfigBool(tr("Cache Display Lists"), Config::GFX_DISPLAY_LIST_CACHE, m_game_layer);
 
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
   experimental_layout->addWidget(m_manual_texture_sampling, 0, 1);
+  experimental_layout->addWidget(m_display_list_cache, 1, 0);
 
   main_layout->addWidget(performance_box);
   main_layout->addWidget(debugging_box);
@@ -297,6 +303,11 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Changes the color of the FPS counter depending on emulation speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
                  "checked.</dolphin_emphasis>");
+  static const char TR_SHOW_AUDIO_LATENCY_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how much emulated audio is buffered before it's played, how much the "
+                 "audio buffer aims for, and how irregularly the audio backend asks for audio."
+                 "<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
   static const char TR_PERF_SAMP_WINDOW_DESCRIPTION[] =
       QT_TR_NOOP("The amount of time the FPS and VPS counters will sample over."
                  "<br><br>The higher the value, the more stable the FPS/VPS counter will be, "
@@ -413,6 +424,12 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Cull vertices on the CPU to reduce the number of draw calls required.  "
                  "May affect performance and draw statistics.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_DISPLAY_LIST_CACHE_DESCRIPTION[] =
+      QT_TR_NOOP("Keeps the converted vertex data of display lists, and reuses it when a game "
+                 "calls the same unmodified display list again. Only vertices that don't use "
+                 "indexed attributes are cached.<br><br>May improve performance in games that draw "
+                 "static geometry from display lists, at the cost of some memory.<br><br>"
+                 "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION[] = QT_TR_NOOP(
       "Defers invalidation of the EFB access cache until a GPU synchronization command "
       "is executed. If disabled, the cache will be invalidated with every draw call. "
@@ -451,6 +468,7 @@ void AdvancedWidget::AddDescriptions()
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
   m_show_speed_colors->SetDescription(tr(TR_SHOW_SPEED_COLORS_DESCRIPTION));
+  m_show_audio_latency->SetDescription(tr(TR_SHOW_AUDIO_LATENCY_DESCRIPTION));
 
   m_enable_wireframe->SetDescription(tr(TR_WIREFRAME_DESCRIPTION));
   m_show_statistics->SetDescription(tr(TR_SHOW_STATS_DESCRIPTION));
@@ -492,4 +510,5 @@ void AdvancedWidget::AddDescriptions()
 #endif
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
   m_manual_texture_sampling->SetDescription(tr(TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION));
+  m_display_list_cache->SetDescription(tr(TR_DISPLAY_LIST_CACHE_DESCRIPTION));
 }
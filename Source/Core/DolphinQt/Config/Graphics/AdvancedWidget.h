@@ -41,6 +41,7 @@ private:
   ConfigBool* m_show_graphs;
   ConfigBool* m_show_speed;
   ConfigBool* m_show_speed_colors;
+  ConfigBool* m_show_audio_latency;
   ConfigInteger* m_perf_samp_window;
   ConfigBool* m_log_render_time;
 
@@ -74,6 +75,7 @@ private:
   // Experimental
   ConfigBool* m_defer_efb_access_invalidation;
   ConfigBool* m_manual_texture_sampling;
+  ConfigBool* m_display_list_cache;
 
   Config::Layer* m_game_layer = nullptr;
 };
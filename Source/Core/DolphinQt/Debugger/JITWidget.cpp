@@ -4,6 +4,7 @@
 #include "DolphinQt/Debugger/JITWidget.h"
 
 #include <algorithm>
+#include <chrono>
 #include <optional>
 #include <ranges>
 #include <utility>
@@ -191,6 +192,18 @@ void JITWidget::ShowFreeMemoryStatus()
                        .arg(QtUtils::FromStdString(name))
                        .arg(fragmentation_ratio * 100.0, 0, 'f', 2));
   }
+
+  const JitInvalidationStats invalidation_stats =
+      m_system.GetJitInterface().GetInvalidationStats();
+  const double erase_time_ms =
+      std::chrono::duration<double, std::milli>(invalidation_stats.erase_time).count();
+  // i18n: %1 is the number of ranges of code which were invalidated, %2 the time this took,
+  // %3 how many cache lines were invalidated by icbi, and %4 how many sweeps applied those.
+  message.append(tr(" | Invalidated %1 ranges in %2 ms (%3 icbi lines in %4 sweeps)")
+                     .arg(invalidation_stats.erased_ranges)
+                     .arg(erase_time_ms, 0, 'f', 2)
+                     .arg(invalidation_stats.queued_lines)
+                     .arg(invalidation_stats.sweeps));
   m_status_bar->showMessage(message);
 }
 
@@ -238,14 +251,19 @@ void JITWidget::CrossDisassemble(const JitBlock& block)
   // %1 and %2 are instruction counts from the near and far code caches, respectively. %3 is a
   // percentage calculated from how inefficient (in other words, "blown-up") a given JIT block's
   // recompilation was when considering the host instruction count vs the PPC instruction count.
-  m_status_bar->showMessage(tr("Host instruction count: %1 near %2 far (%3% blowup)")
-                                .arg(host_near_instruction_count)
-                                .arg(host_far_instruction_count)
-                                .arg(static_cast<double>(100 * (host_near_instruction_count +
-                                                                host_far_instruction_count)) /
-                                             block.originalSize -
-                                         100.0,
-                                     0, 'f', 2));
+  QString message = tr("Host instruction count: %1 near %2 far (%3% blowup)")
+                        .arg(host_near_instruction_count)
+                        .arg(host_far_instruction_count)
+                        .arg(static_cast<double>(100 * (host_near_instruction_count +
+                                                        host_far_instruction_count)) /
+                                     block.originalSize -
+                                 100.0,
+                             0, 'f', 2);
+  // i18n: An idle loop is a loop which only waits for something to change, which Dolphin skips
+  // by fast-forwarding to the next scheduled event.
+  if (block.idle_loop)
+    message = tr("%1, ends in an idle loop").arg(message);
+  m_status_bar->showMessage(message);
 }
 
 void JITWidget::CrossDisassemble(const QModelIndex& index)
@@ -165,6 +165,13 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_search_instruction->setEnabled(running);
   m_jit_wipe_profiling_data->setEnabled(jit_exists);
   m_jit_write_cache_log_dump->setEnabled(jit_exists);
+  {
+    const QSignalBlocker blocker(m_jit_guest_profiler);
+    m_jit_guest_profiler->setEnabled(running);
+    m_jit_guest_profiler->setChecked(
+        running && Core::System::GetInstance().GetPowerPC().GetGuestProfiler().IsRunning());
+  }
+  m_jit_write_guest_profile->setEnabled(running);
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -241,6 +248,53 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnToggleGuestProfiler(bool enabled)
+{
+  auto& system = Core::System::GetInstance();
+  const Core::CPUThreadGuard guard(system);
+  auto& guest_profiler = system.GetPowerPC().GetGuestProfiler();
+  if (enabled)
+  {
+    guest_profiler.Clear();
+    guest_profiler.Start(guard);
+  }
+  else
+  {
+    guest_profiler.Stop(guard);
+  }
+}
+
+void MenuBar::OnWriteGuestProfile()
+{
+  const std::string path = fmt::format("{}{}_profile", File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
+                                       SConfig::GetInstance().GetGameID());
+  const std::string collapsed_filename = path + ".folded";
+  const std::string report_filename = path + ".txt";
+  File::IOFile collapsed_file(collapsed_filename, "w");
+  File::IOFile report_file(report_filename, "w");
+  if (!collapsed_file || !report_file)
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.")
+            .arg(QString::fromStdString(collapsed_file ? report_filename : collapsed_filename)));
+    return;
+  }
+
+  auto& system = Core::System::GetInstance();
+  {
+    const Core::CPUThreadGuard guard(system);
+    const auto& power_pc = system.GetPowerPC();
+    const auto& guest_profiler = power_pc.GetGuestProfiler();
+    guest_profiler.WriteCollapsedStacks(power_pc.GetSymbolDB(), collapsed_file.GetHandle());
+    guest_profiler.WriteFunctionReport(power_pc.GetSymbolDB(), report_file.GetHandle());
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\" and \"%2\".")
+                                   .arg(QString::fromStdString(collapsed_filename))
+                                   .arg(QString::fromStdString(report_filename)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -946,6 +1000,11 @@ void MenuBar::AddJITMenu()
                                                &MenuBar::OnWipeJitBlockProfilingData);
   m_jit_write_cache_log_dump =
       m_jit->addAction(tr("Write JIT Block Log Dump"), this, &MenuBar::OnWriteJitBlockLogDump);
+  m_jit_guest_profiler = m_jit->addAction(tr("Enable Guest Function Profiler"));
+  m_jit_guest_profiler->setCheckable(true);
+  connect(m_jit_guest_profiler, &QAction::toggled, this, &MenuBar::OnToggleGuestProfiler);
+  m_jit_write_guest_profile =
+      m_jit->addAction(tr("Write Guest Function Profile"), this, &MenuBar::OnWriteGuestProfile);
 
   m_jit->addSeparator();
 
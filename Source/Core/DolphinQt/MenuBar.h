@@ -194,6 +194,8 @@ private:
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnToggleGuestProfiler(bool enabled);
+  void OnWriteGuestProfile();
 
   QString GetSignatureSelector() const;
 
@@ -285,6 +287,8 @@ private:
   QAction* m_jit_profile_blocks;
   QAction* m_jit_wipe_profiling_data;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_jit_guest_profiler;
+  QAction* m_jit_write_guest_profile;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
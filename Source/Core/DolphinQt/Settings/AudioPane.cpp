@@ -71,6 +71,10 @@ void AudioPane::CreateWidgets()
   dsp_layout->addWidget(dsp_combo_label);
   dsp_layout->addWidget(m_dsp_combo, Qt::AlignLeft);
 
+  m_dsp_hle_worker_thread =
+      new ConfigBool(tr("HLE Worker Thread"), Config::MAIN_DSP_HLE_WORKER_THREAD);
+  dsp_layout->addWidget(m_dsp_hle_worker_thread);
+
   auto* volume_box = new QGroupBox(tr("Volume"));
   auto* volume_layout = new QVBoxLayout{volume_box};
 
@@ -184,9 +188,20 @@ void AudioPane::CreateWidgets()
 
   m_audio_fill_gaps = new ConfigBool(tr("Fill Audio Gaps"), Config::MAIN_AUDIO_FILL_GAPS);
 
+  m_adaptive_buffer =
+      new ConfigBool(tr("Adaptive Audio Buffer"), Config::MAIN_AUDIO_ADAPTIVE_BUFFER);
+
   m_speed_up_mute_enable = new ConfigBool(tr("Mute When Disabling Speed Limit"),
                                           Config::MAIN_AUDIO_MUTE_ON_DISABLED_SPEED_LIMIT);
 
+  const QStringList time_stretch_options{tr("Off"), tr("Low"), tr("Medium"), tr("High")};
+  m_time_stretch_combo =
+      new ConfigChoice(time_stretch_options, Config::MAIN_AUDIO_TIME_STRETCH_QUALITY);
+
+  auto* time_stretch_layout = new QHBoxLayout;
+  time_stretch_layout->addWidget(new QLabel(tr("Time Stretching:")));
+  time_stretch_layout->addWidget(m_time_stretch_combo);
+
   // Create a horizontal layout for the slider + value label
   auto* buffer_layout = new QHBoxLayout;
   buffer_layout->addWidget(new ConfigSliderLabel(tr("Audio Buffer Size:"), audio_buffer_size));
@@ -194,9 +209,11 @@ void AudioPane::CreateWidgets()
   buffer_layout->addWidget(audio_buffer_size_label);
 
   playback_layout->addLayout(buffer_layout, 0, 0);
-  playback_layout->addWidget(m_audio_fill_gaps, 1, 0);
-  playback_layout->addWidget(m_speed_up_mute_enable, 2, 0);
-  playback_layout->setRowStretch(3, 1);
+  playback_layout->addWidget(m_adaptive_buffer, 1, 0);
+  playback_layout->addWidget(m_audio_fill_gaps, 2, 0);
+  playback_layout->addWidget(m_speed_up_mute_enable, 3, 0);
+  playback_layout->addLayout(time_stretch_layout, 4, 0);
+  playback_layout->setRowStretch(5, 1);
   playback_box->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
 
   auto* const main_vbox_layout = new QVBoxLayout;
@@ -236,6 +253,9 @@ void AudioPane::OnDspChanged()
   m_dolby_pro_logic->setEnabled(enabled);
   m_dolby_quality_label->setEnabled(enabled && m_dolby_pro_logic->isChecked());
   m_dolby_quality_combo->setEnabled(enabled && m_dolby_pro_logic->isChecked());
+
+  m_dsp_hle_worker_thread->setEnabled(Config::Get(Config::MAIN_DSP_HLE) &&
+                                      Core::IsUninitialized(Core::System::GetInstance()));
 }
 
 void AudioPane::OnBackendChanged()
@@ -263,6 +283,7 @@ void AudioPane::OnBackendChanged()
 void AudioPane::OnEmulationStateChanged(bool running)
 {
   m_dsp_combo->setEnabled(!running);
+  m_dsp_hle_worker_thread->setEnabled(!running && Config::Get(Config::MAIN_DSP_HLE));
   m_backend_label->setEnabled(!running);
   m_backend_combo->setEnabled(!running);
   if (AudioCommon::SupportsDPL2Decoder(Config::Get(Config::MAIN_AUDIO_BACKEND)) &&
@@ -302,6 +323,12 @@ void AudioPane::AddDescriptions()
       "<b>LLE Interpreter</b> - Low Level Emulation of the DSP, via an interpreter. Slowest, for "
       "debugging purposes only. Not recommended.<br><br><dolphin_emphasis>If unsure, select "
       "HLE.</dolphin_emphasis>");
+  static const char TR_DSP_HLE_WORKER_THREAD_DESCRIPTION[] = QT_TR_NOOP(
+      "Processes HLE audio on a separate thread, in parallel with the emulated CPU. Improves "
+      "performance in games with many voices, at the cost of delivering the DSP's results to the "
+      "game slightly later.<br><br>Has no effect during NetPlay or when recording or playing "
+      "back a movie.<br><br><dolphin_emphasis>If unsure, leave this unchecked."
+      "</dolphin_emphasis>");
   static const char TR_AUDIO_BACKEND_DESCRIPTION[] =
       QT_TR_NOOP("Selects which audio API to use internally.<br><br><dolphin_emphasis>If unsure, "
                  "select %1.</dolphin_emphasis>");
@@ -320,6 +347,19 @@ void AudioPane::AddDescriptions()
   static const char TR_FILL_AUDIO_GAPS_DESCRIPTION[] = QT_TR_NOOP(
       "Repeat existing audio during lag spikes to prevent stuttering.<br><br><dolphin_emphasis>If "
       "unsure, leave this checked.</dolphin_emphasis>");
+  static const char TR_ADAPTIVE_BUFFER_DESCRIPTION[] = QT_TR_NOOP(
+      "Shrinks the audio buffer while the audio backend delivers audio on time, and grows it again "
+      "when it doesn't or when the audio crackles. The audio buffer size becomes the most that is "
+      "buffered.<br><br>The current latency can be shown with Show Audio Latency in the "
+      "graphics settings.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
+  static const char TR_TIME_STRETCH_DESCRIPTION[] = QT_TR_NOOP(
+      "Keeps the pitch of the audio when the emulation runs slower or faster than normal, such as "
+      "during slowdowns or when fast-forwarding. The audio plays at the speed the emulation runs "
+      "at, up to 4x, instead of being resampled to a higher or lower pitch or repeated to fill "
+      "gaps.<br><br>Adds about 50 to 80 ms of audio latency. Higher quality settings sound "
+      "smoother but use more CPU.<br><br><dolphin_emphasis>If unsure, select "
+      "Off.</dolphin_emphasis>");
   static const char TR_SPEED_UP_MUTE_DESCRIPTION[] =
       QT_TR_NOOP("Mutes the audio when overriding the emulation speed limit (default hotkey: Tab). "
                  "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -327,6 +367,8 @@ void AudioPane::AddDescriptions()
   m_dsp_combo->SetTitle(tr("DSP Emulation Engine"));
   m_dsp_combo->SetDescription(tr(TR_DSP_DESCRIPTION));
 
+  m_dsp_hle_worker_thread->SetDescription(tr(TR_DSP_HLE_WORKER_THREAD_DESCRIPTION));
+
   m_backend_combo->SetTitle(tr("Audio Backend"));
   m_backend_combo->SetDescription(
       tr(TR_AUDIO_BACKEND_DESCRIPTION)
@@ -360,4 +402,10 @@ void AudioPane::AddDescriptions()
 
   m_audio_fill_gaps->SetTitle(tr("Fill Audio Gaps"));
   m_audio_fill_gaps->SetDescription(tr(TR_FILL_AUDIO_GAPS_DESCRIPTION));
+
+  m_adaptive_buffer->SetTitle(tr("Adaptive Audio Buffer"));
+  m_adaptive_buffer->SetDescription(tr(TR_ADAPTIVE_BUFFER_DESCRIPTION));
+
+  m_time_stretch_combo->SetTitle(tr("Time Stretching"));
+  m_time_stretch_combo->SetDescription(tr(TR_TIME_STRETCH_DESCRIPTION));
 }
@@ -44,6 +44,7 @@ private:
 
   // DSP Engine
   ConfigComplexChoice* m_dsp_combo;
+  ConfigBool* m_dsp_hle_worker_thread;
 
   // Volume
   ConfigSlider* m_volume_slider;
@@ -66,5 +67,7 @@ private:
 
   // Misc Settings
   ConfigBool* m_audio_fill_gaps;
+  ConfigBool* m_adaptive_buffer;
+  ConfigChoice* m_time_stretch_combo;
   ConfigBool* m_speed_up_mute_enable;
 };
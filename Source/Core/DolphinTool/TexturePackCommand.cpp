@@ -0,0 +1,128 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TexturePackCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+namespace DolphinTool
+{
+int TexturePackCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texpack [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the custom texture DIRECTORY (e.g. Load/Textures/<GameID>).")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack FILE to write. Name it <GameID>.dtp and place it in "
+            "Load/Textures for Dolphin to use it.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& input_directory = options["input"];
+  if (input_directory.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  if (!File::IsDirectory(input_directory))
+  {
+    fmt::print(std::cerr, "Error: Input must be a directory\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& output_file_path = options["output"];
+  if (output_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  VideoCommon::TexturePackWriter writer;
+  if (!writer.Open(output_file_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to open output file\n");
+    return EXIT_FAILURE;
+  }
+
+  // Mipmap levels are stored as separate files, and get picked up when loading the base level.
+  static const std::regex mip_level_regex(".*_mip[0-9]+$");
+
+  const auto texture_paths =
+      Common::DoFileSearch({input_directory}, {".png", ".dds"}, /*recursive*/ true);
+  std::set<std::string> texture_names;
+  u32 skipped = 0;
+  for (const std::string& path : texture_paths)
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (!filename.starts_with("tex1_") || std::regex_match(filename, mip_level_regex))
+      continue;
+
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    // Dolphin only uses the first texture it finds for a name when loading a texture directory
+    if (!texture_names.insert(filename).second)
+    {
+      fmt::print(std::cerr, "Warning: Skipping '{}', a texture with the same name came first\n",
+                 path);
+      skipped++;
+      continue;
+    }
+
+    VideoCommon::CustomTextureData data;
+    if (!VideoCommon::LoadTextureDataFromFile(
+            filename, path, VideoCommon::TextureAndSamplerData::Type::Type_Texture2D, &data) ||
+        !VideoCommon::PurgeInvalidMipsFromTextureData(filename, &data))
+    {
+      fmt::print(std::cerr, "Warning: Skipping '{}', it could not be loaded\n", path);
+      skipped++;
+      continue;
+    }
+
+    if (!writer.AddTexture(filename, has_arbitrary_mipmaps, data))
+    {
+      fmt::print(std::cerr, "Error: Failed to write '{}' to the texture pack\n", path);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (!writer.Finish())
+  {
+    fmt::print(std::cerr, "Error: Failed to write the texture pack index\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Packed {} textures ({} skipped)\n", writer.GetTextureCount(), skipped);
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -12,9 +12,9 @@
 
 namespace VideoCommon
 {
-void CustomAssetLoader::Initialize()
+void CustomAssetLoader::Initialize(u32 num_worker_threads)
 {
-  ResizeWorkerThreads(2);
+  ResizeWorkerThreads(num_worker_threads);
 }
 
 void CustomAssetLoader::Shutdown()
@@ -29,7 +29,7 @@ public:
   CustomAssetLoader& operator=(const CustomAssetLoader&) = delete;
   CustomAssetLoader& operator=(CustomAssetLoader&&) = delete;
 
-  void Initialize();
+  void Initialize(u32 num_worker_threads);
   void Shutdown();
 
   using AssetHandle = std::pair<std::size_t, bool>;
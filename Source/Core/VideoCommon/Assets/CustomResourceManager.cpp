@@ -3,6 +3,8 @@
 
 #include "VideoCommon/Assets/CustomResourceManager.h"
 
+#include <algorithm>
+
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 
@@ -10,6 +12,7 @@
 
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
 
 namespace VideoCommon
@@ -24,10 +27,21 @@ void CustomResourceManager::Initialize()
 
   m_max_ram_available = sys_mem - keep_unused_mem;
 
+  // A user-defined budget lets large texture packs be streamed on systems that can't afford to
+  // keep them resident.
+  if (g_ActiveConfig.iHiresTextureMemoryBudget > 0)
+  {
+    const u64 budget = u64(g_ActiveConfig.iHiresTextureMemoryBudget) * 1024 * 1024;
+    m_max_ram_available = std::min(m_max_ram_available, budget);
+  }
+
   if (m_max_ram_available == 0)
     ERROR_LOG_FMT(VIDEO, "Not enough system memory for custom resources.");
 
-  m_asset_loader.Initialize();
+  INFO_LOG_FMT(VIDEO, "Custom resource memory budget: {}",
+               UICommon::FormatSize(m_max_ram_available));
+
+  m_asset_loader.Initialize(g_ActiveConfig.GetHiresTextureLoaderThreads());
 
   m_xfb_event =
       AfterFrameEvent::Register([this](Core::System&) { XFBTriggered(); }, "CustomResourceManager");
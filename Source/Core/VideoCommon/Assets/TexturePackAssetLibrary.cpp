@@ -0,0 +1,244 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "Common/Align.h"
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/RenderState.h"
+
+namespace VideoCommon
+{
+namespace
+{
+template <typename T>
+bool ReadFromIndex(const std::vector<u8>& index, std::size_t* position, T* out)
+{
+  if (index.size() - *position < sizeof(T))
+    return false;
+  std::memcpy(out, index.data() + *position, sizeof(T));
+  *position += sizeof(T);
+  return true;
+}
+
+template <typename T>
+void AppendToIndex(std::vector<u8>* index, const T& value)
+{
+  const u8* const bytes = reinterpret_cast<const u8*>(&value);
+  index->insert(index->end(), bytes, bytes + sizeof(T));
+}
+}  // namespace
+
+std::shared_ptr<TexturePackAssetLibrary> TexturePackAssetLibrary::Open(const std::string& path)
+{
+  auto library = std::make_shared<TexturePackAssetLibrary>();
+  if (!library->m_file.Open(path, "rb"))
+    return nullptr;
+
+  TexturePack::Header header;
+  if (!library->m_file.ReadArray(&header, 1) || header.magic != TexturePack::TEXTURE_PACK_MAGIC)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid header", path);
+    return nullptr;
+  }
+  if (header.version != TexturePack::TEXTURE_PACK_VERSION)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has unsupported version {}", path, header.version);
+    return nullptr;
+  }
+
+  // The texture data lies between the header and the index, which has to fit in the file
+  const u64 file_size = library->m_file.GetSize();
+  if (header.index_offset < sizeof(header) || header.index_offset > file_size ||
+      header.index_size > file_size - header.index_offset)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid index location", path);
+    return nullptr;
+  }
+
+  std::vector<u8> index(header.index_size);
+  if (!library->m_file.Seek(header.index_offset, File::SeekOrigin::Begin) ||
+      !library->m_file.ReadBytes(index.data(), index.size()))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' index could not be read", path);
+    return nullptr;
+  }
+
+  std::size_t position = 0;
+  for (u32 i = 0; i < header.texture_count; i++)
+  {
+    TexturePack::TextureEntry entry;
+    if (!ReadFromIndex(index, &position, &entry) || index.size() - position < entry.name_length)
+    {
+      ERROR_LOG_FMT(VIDEO, "Texture pack '{}' index is truncated", path);
+      return nullptr;
+    }
+
+    AssetID asset_id(reinterpret_cast<const char*>(index.data() + position), entry.name_length);
+    position += entry.name_length;
+
+    Texture texture;
+    texture.has_arbitrary_mipmaps = entry.has_arbitrary_mipmaps != 0;
+    texture.levels.resize(entry.level_count);
+    for (auto& level : texture.levels)
+    {
+      if (!ReadFromIndex(index, &position, &level) || level.offset > header.index_offset ||
+          level.size > header.index_offset - level.offset)
+      {
+        ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid entry for '{}'", path, asset_id);
+        return nullptr;
+      }
+    }
+
+    // Like the texture directories, the first texture of a name wins
+    if (!library->m_textures.try_emplace(asset_id, std::move(texture)).second)
+      WARN_LOG_FMT(VIDEO, "Texture pack '{}' contains '{}' more than once", path, asset_id);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Opened texture pack '{}' with {} textures", path,
+               library->m_textures.size());
+  return library;
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  CustomTextureData* data)
+{
+  const auto iter = m_textures.find(asset_id);
+  if (iter == m_textures.end())
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - not found in texture pack!", asset_id);
+    return {};
+  }
+
+  std::size_t bytes_loaded = 0;
+  auto& slice = data->m_slices.emplace_back();
+  for (const TexturePack::LevelEntry& entry : iter->second.levels)
+  {
+    auto& level = slice.m_levels.emplace_back();
+    level.format = entry.format;
+    level.width = entry.width;
+    level.height = entry.height;
+    level.row_length = entry.row_length;
+    level.data.reset(entry.size);
+
+    std::lock_guard lk(m_file_lock);
+    if (!m_file.Seek(entry.offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(level.data.data(), entry.size))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - could not read texture data from pack!", asset_id);
+      m_file.ClearError();
+      data->m_slices.clear();
+      return {};
+    }
+    bytes_loaded += entry.size;
+  }
+
+  return LoadInfo{bytes_loaded};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  TextureAndSamplerData* data)
+{
+  data->m_sampler = RenderState::GetLinearSamplerState();
+  data->m_type = TextureAndSamplerData::Type::Type_Texture2D;
+  return LoadTexture(asset_id, &data->m_texture);
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadPixelShader(const AssetID& asset_id,
+                                                                      PixelShaderData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain pixel shaders!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                   MaterialData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain materials!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMesh(const AssetID& asset_id, MeshData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain meshes!", asset_id);
+  return {};
+}
+
+bool TexturePackWriter::Open(const std::string& path)
+{
+  m_index.clear();
+  m_texture_count = 0;
+
+  // The header is written last, once the location of the index is known.
+  const TexturePack::Header header{};
+  return m_file.Open(path, "wb") && m_file.WriteArray(&header, 1);
+}
+
+bool TexturePackWriter::AddTexture(const CustomAssetLibrary::AssetID& asset_id,
+                                   bool has_arbitrary_mipmaps, const CustomTextureData& data)
+{
+  if (data.m_slices.size() != 1 || data.m_slices[0].m_levels.empty() ||
+      data.m_slices[0].m_levels.size() > std::numeric_limits<u8>::max())
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - only 2D textures can be packed!", asset_id);
+    return false;
+  }
+  if (asset_id.size() > std::numeric_limits<u16>::max())
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - name is too long to be packed!", asset_id);
+    return false;
+  }
+
+  const auto& levels = data.m_slices[0].m_levels;
+  TexturePack::TextureEntry entry;
+  entry.name_length = static_cast<u16>(asset_id.size());
+  entry.has_arbitrary_mipmaps = has_arbitrary_mipmaps;
+  entry.level_count = static_cast<u8>(levels.size());
+  AppendToIndex(&m_index, entry);
+  m_index.insert(m_index.end(), asset_id.begin(), asset_id.end());
+
+  static constexpr std::array<u8, TexturePack::TEXTURE_PACK_ALIGNMENT> padding{};
+  for (const auto& level : levels)
+  {
+    const u64 position = m_file.Tell();
+    const u64 offset = Common::AlignUp(position, TexturePack::TEXTURE_PACK_ALIGNMENT);
+    if (!m_file.WriteBytes(padding.data(), offset - position) ||
+        !m_file.WriteBytes(level.data.data(), level.data.size()))
+    {
+      return false;
+    }
+
+    TexturePack::LevelEntry level_entry;
+    level_entry.format = level.format;
+    level_entry.width = level.width;
+    level_entry.height = level.height;
+    level_entry.row_length = level.row_length;
+    level_entry.offset = offset;
+    level_entry.size = level.data.size();
+    AppendToIndex(&m_index, level_entry);
+  }
+
+  m_texture_count++;
+  return true;
+}
+
+bool TexturePackWriter::Finish()
+{
+  TexturePack::Header header;
+  header.magic = TexturePack::TEXTURE_PACK_MAGIC;
+  header.version = TexturePack::TEXTURE_PACK_VERSION;
+  header.texture_count = m_texture_count;
+  header.reserved = 0;
+  header.index_offset = m_file.Tell();
+  header.index_size = m_index.size();
+
+  return m_file.WriteBytes(m_index.data(), m_index.size()) &&
+         m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteArray(&header, 1) &&
+         m_file.Close();
+}
+}  // namespace VideoCommon
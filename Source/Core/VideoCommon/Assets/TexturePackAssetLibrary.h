@@ -0,0 +1,112 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/TextureConfig.h"
+
+namespace VideoCommon
+{
+// A texture pack is a single file holding already decoded custom textures (RGBA8 for PNGs,
+// the original block-compressed data for DDS files), together with an index mapping texture names
+// to their data.  It avoids the directory scans and PNG decoding of a loose texture folder.
+//
+// Layout: a header, the level data of all textures (each level aligned to TEXTURE_PACK_ALIGNMENT
+// bytes), followed by the index.
+namespace TexturePack
+{
+constexpr u32 TEXTURE_PACK_MAGIC = 0x50544C44;  // "DLTP"
+constexpr u32 TEXTURE_PACK_VERSION = 1;
+constexpr u64 TEXTURE_PACK_ALIGNMENT = 64;
+constexpr std::string_view TEXTURE_PACK_EXTENSION = ".dtp";
+
+#pragma pack(push, 1)
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 texture_count;
+  u32 reserved;
+  u64 index_offset;
+  u64 index_size;
+};
+static_assert(sizeof(Header) == 32);
+
+// Each index entry is a TextureEntry, followed by its name and then level_count LevelEntries.
+struct TextureEntry
+{
+  u16 name_length;
+  u8 has_arbitrary_mipmaps;
+  u8 level_count;
+};
+static_assert(sizeof(TextureEntry) == 4);
+
+struct LevelEntry
+{
+  AbstractTextureFormat format;
+  u32 width;
+  u32 height;
+  u32 row_length;
+  u64 offset;
+  u64 size;
+};
+static_assert(sizeof(LevelEntry) == 32);
+#pragma pack(pop)
+}  // namespace TexturePack
+
+// This class implements 'CustomAssetLibrary' and loads raw textures from a texture pack
+class TexturePackAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  struct Texture
+  {
+    bool has_arbitrary_mipmaps = false;
+    std::vector<TexturePack::LevelEntry> levels;
+  };
+
+  // Returns nullptr if the file is not a valid texture pack
+  static std::shared_ptr<TexturePackAssetLibrary> Open(const std::string& path);
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureAndSamplerData* data) override;
+  LoadInfo LoadTexture(const AssetID& asset_id, CustomTextureData* data) override;
+  LoadInfo LoadPixelShader(const AssetID& asset_id, PixelShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+  const std::map<AssetID, Texture>& GetTextures() const { return m_textures; }
+
+private:
+  File::IOFile m_file;
+  std::mutex m_file_lock;
+  std::map<AssetID, Texture> m_textures;
+};
+
+// Writes a texture pack, streaming the texture data to disk as textures are added
+class TexturePackWriter
+{
+public:
+  bool Open(const std::string& path);
+  bool AddTexture(const CustomAssetLibrary::AssetID& asset_id, bool has_arbitrary_mipmaps,
+                  const CustomTextureData& data);
+  // Writes the index and header; the pack is incomplete until this succeeds
+  bool Finish();
+
+  u32 GetTextureCount() const { return m_texture_count; }
+
+private:
+  File::IOFile m_file;
+  std::vector<u8> m_index;
+  u32 m_texture_count = 0;
+};
+}  // namespace VideoCommon
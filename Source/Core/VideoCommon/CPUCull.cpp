@@ -3,6 +3,8 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -10,6 +12,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -164,9 +167,32 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cull_mode = cullmode_invert[cull_mode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cull_mode];
-  return cull(m_transform_buffer.get(), count);
+
+  INCSTAT(g_stats.this_frame.num_cpu_cull_draws);
+
+  // Most draws have a visible triangle early on, so transform and cull in chunks and stop at the
+  // first one that survives instead of transforming the whole draw up front.  Fans always need
+  // their first vertex, so they are done in one go.
+  const u32 chunk_size =
+      primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN ? count : CULL_CHUNK_SIZE;
+  TransformedVertex* const transformed = m_transform_buffer.get();
+  for (u32 start = 0; start < count; start += chunk_size)
+  {
+    const u32 run = std::min(chunk_size, count - start);
+    transform(&transformed[start], src + start * stride, stride, run);
+
+    // Strips need the last two vertices of the previous chunk to form the first triangle.
+    // Chunks start at even vertices, so the winding order is preserved.
+    const u32 overlap =
+        start != 0 && primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP ? 2 : 0;
+    if (!cull(&transformed[start - overlap], run + overlap))
+      return false;
+  }
+
+  INCSTAT(g_stats.this_frame.num_cpu_culled_draws);
+  ADDSTAT(g_stats.this_frame.num_cpu_culled_vertices, count);
+  return true;
 }
 
 template <typename T>
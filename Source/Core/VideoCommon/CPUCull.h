@@ -24,6 +24,10 @@ public:
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
 private:
+  // Number of vertices transformed and culled at once.  Divisible by 3 (triangles), 4 (quads) and
+  // 2 (so strips keep their winding order across chunks).
+  static constexpr u32 CULL_CHUNK_SIZE = 768;
+
   template <typename T>
   struct BufferDeleter
   {
@@ -26,6 +26,7 @@
 #include "Core/System.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -35,6 +36,7 @@ static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_te
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+static std::shared_ptr<VideoCommon::TexturePackAssetLibrary> s_texture_pack_library;
 
 namespace
 {
@@ -74,6 +76,23 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 
   return {"", false};
 }
+
+// Looks for a packed version of the game's textures, either region-specific or region-free
+std::shared_ptr<VideoCommon::TexturePackAssetLibrary> OpenTexturePack(const std::string& game_id)
+{
+  const std::string root_directory = File::GetUserPath(D_HIRESTEXTURES_IDX);
+  for (const std::string& name : {game_id, game_id.substr(0, 3)})
+  {
+    const std::string path =
+        root_directory + name + std::string(VideoCommon::TexturePack::TEXTURE_PACK_EXTENSION);
+    if (!File::Exists(path))
+      continue;
+
+    if (auto library = VideoCommon::TexturePackAssetLibrary::Open(path))
+      return library;
+  }
+  return nullptr;
+}
 }  // namespace
 
 void HiresTexture::Shutdown()
@@ -90,6 +109,33 @@ void HiresTexture::Update()
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
+
+  // With a memory budget, textures are streamed in as the game uses them. Prefetching the whole
+  // pack would only keep evicting and reloading textures that don't fit.
+  const bool prefetch =
+      g_ActiveConfig.bCacheHiresTextures && g_ActiveConfig.iHiresTextureMemoryBudget <= 0;
+
+  // A texture pack replaces the texture directories, so there is nothing to scan.
+  s_texture_pack_library = OpenTexturePack(game_id);
+  if (s_texture_pack_library)
+  {
+    for (const auto& [id, texture] : s_texture_pack_library->GetTextures())
+    {
+      s_hires_texture_id_to_arbmipmap.try_emplace(id, texture.has_arbitrary_mipmaps);
+      if (prefetch)
+      {
+        auto hires_texture = std::make_shared<HiresTexture>(texture.has_arbitrary_mipmaps, id);
+        static_cast<void>(hires_texture->LoadTexture());
+        s_hires_texture_cache.try_emplace(id, std::move(hires_texture));
+      }
+    }
+
+    OSD::AddMessage(fmt::format("Found '{}' custom textures in texture pack",
+                                s_hires_texture_id_to_arbmipmap.size()),
+                    10000);
+    return;
+  }
+
   const std::set<std::string> texture_directories =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
   const std::vector<std::string> extensions{".png", ".dds"};
@@ -128,7 +174,7 @@ void HiresTexture::Update()
           s_file_library->SetAssetIDMapData(filename, std::map<std::string, std::filesystem::path>{
                                                           {"texture", StringToPath(path)}});
 
-          if (g_ActiveConfig.bCacheHiresTextures)
+          if (prefetch)
           {
             auto hires_texture =
                 std::make_shared<HiresTexture>(has_arbitrary_mipmaps, std::move(filename));
@@ -146,7 +192,7 @@ void HiresTexture::Update()
     }
   }
 
-  if (g_ActiveConfig.bCacheHiresTextures)
+  if (prefetch)
   {
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
                     10000);
@@ -163,6 +209,7 @@ void HiresTexture::Clear()
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+  s_texture_pack_library.reset();
 }
 
 std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
@@ -195,6 +242,8 @@ VideoCommon::CustomResourceManager::TextureTimePair HiresTexture::LoadTexture()
 {
   auto& system = Core::System::GetInstance();
   auto& custom_resource_manager = system.GetCustomResourceManager();
+  if (s_texture_pack_library)
+    return custom_resource_manager.GetTextureDataFromAsset(m_id, s_texture_pack_library);
   return custom_resource_manager.GetTextureDataFromAsset(m_id, s_file_library);
 }
 
@@ -11,9 +11,17 @@
 // are while interpreting them, and hope that the vertex format doesn't change, though, if you do
 // it right when they are called. The reason is that the vertex format affects the sizes of the
 // vertices.
+// The display list cache below does exactly that: the first call of a display list records the
+// loader output of each primitive, and later calls with identical contents reuse it for every
+// primitive whose vertex loader (and thus format) is still the same.
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <unordered_map>
+#include <vector>
+
+#include <xxhash.h>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -27,6 +35,7 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 #include "VideoCommon/XFStructs.h"
@@ -35,6 +44,35 @@ namespace OpcodeDecoder
 {
 bool g_record_fifo_data = false;
 
+namespace
+{
+struct CachedPrimitive
+{
+  u32 offset;  // Offset of the vertex data within the display list
+  VertexLoaderManager::CachedVertexData vertices;
+};
+
+struct CachedDisplayList
+{
+  u64 hash = 0;
+  size_t size = 0;  // Bytes of vertex data held by this entry
+  std::vector<CachedPrimitive> primitives;
+};
+
+// Upper bound for the converted vertex data kept around; the cache is flushed when exceeded.
+constexpr size_t MAX_DISPLAY_LIST_CACHE_SIZE = 64 * 1024 * 1024;
+
+// Only accessed from the GPU thread. Keyed by (address << 32) | size.
+std::unordered_map<u64, CachedDisplayList> s_display_list_cache;
+size_t s_display_list_cache_size = 0;
+}  // namespace
+
+void ClearDisplayListCache()
+{
+  s_display_list_cache.clear();
+  s_display_list_cache_size = 0;
+}
+
 template <bool is_preprocess>
 class RunCallback final : public Callback
 {
@@ -130,8 +168,15 @@ public:
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    VertexLoaderManager::CachedVertexData* cached_data = nullptr;
+    if constexpr (!is_preprocess)
+    {
+      if (m_cached_display_list != nullptr)
+        cached_data = GetCachedVertexData(vertex_data);
+    }
+
+    const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(
+        vat, primitive, num_vertices, vertex_data, cached_data);
 
     ASSERT(bytes == size);
 
@@ -188,9 +233,17 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
+          if (g_ActiveConfig.bDisplayListCache)
+            BeginCachedDisplayList(address, size, start_address);
+          else if (!s_display_list_cache.empty())
+            ClearDisplayListCache();
+
           Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
+          if (m_cached_display_list != nullptr)
+            EndCachedDisplayList();
+
           // un-swap
           g_stats.SwapDL();
         }
@@ -255,6 +308,66 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+
+private:
+  void BeginCachedDisplayList(u32 address, u32 size, const u8* start_address)
+  {
+    const u64 key = (static_cast<u64>(address) << 32) | size;
+    const u64 hash = XXH3_64bits(start_address, size);
+
+    auto [iter, inserted] = s_display_list_cache.try_emplace(key);
+    CachedDisplayList& entry = iter->second;
+    m_recording_display_list = inserted || entry.hash != hash;
+    if (m_recording_display_list)
+    {
+      // The display list was modified in RAM since it was cached (or is new); record it again.
+      entry.hash = hash;
+      entry.primitives.clear();
+    }
+
+    m_cached_display_list = &entry;
+    m_display_list_start = start_address;
+    m_display_list_primitive_index = 0;
+  }
+
+  void EndCachedDisplayList()
+  {
+    // Entries can also be refreshed during replay if a loader changed, so always recount.
+    size_t size = 0;
+    for (const CachedPrimitive& primitive : m_cached_display_list->primitives)
+      size += primitive.vertices.data.size();
+    s_display_list_cache_size += size - m_cached_display_list->size;
+    m_cached_display_list->size = size;
+    m_cached_display_list = nullptr;
+
+    if (s_display_list_cache_size > MAX_DISPLAY_LIST_CACHE_SIZE)
+      ClearDisplayListCache();
+  }
+
+  VertexLoaderManager::CachedVertexData* GetCachedVertexData(const u8* vertex_data)
+  {
+    const u32 offset = static_cast<u32>(vertex_data - m_display_list_start);
+    auto& primitives = m_cached_display_list->primitives;
+
+    if (m_recording_display_list)
+      return &primitives.emplace_back(CachedPrimitive{offset, {}}).vertices;
+
+    if (m_display_list_primitive_index < primitives.size() &&
+        primitives[m_display_list_primitive_index].offset == offset)
+    {
+      return &primitives[m_display_list_primitive_index++].vertices;
+    }
+
+    // A vertex format change outside of the display list moved the primitives around; the rest of
+    // the cached data no longer lines up, so decode normally from here on.
+    m_display_list_primitive_index = primitives.size();
+    return nullptr;
+  }
+
+  CachedDisplayList* m_cached_display_list = nullptr;
+  const u8* m_display_list_start = nullptr;
+  size_t m_display_list_primitive_index = 0;
+  bool m_recording_display_list = false;
 };
 
 template <bool is_preprocess>
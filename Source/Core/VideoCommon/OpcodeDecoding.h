@@ -281,6 +281,9 @@ DOLPHIN_FORCE_INLINE u32 Run(const u8* data, u32 available, T& callback)
 template <bool is_preprocess = false>
 u8* RunFifo(DataReader src, u32* cycles);
 
+// Drops all display lists cached for replay (see GFX_DISPLAY_LIST_CACHE).
+void ClearDisplayListCache();
+
 }  // namespace OpcodeDecoder
 
 template <>
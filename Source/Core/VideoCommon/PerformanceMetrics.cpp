@@ -8,7 +8,10 @@
 #include <imgui.h>
 #include <implot.h>
 
+#include "AudioCommon/Mixer.h"
+#include "AudioCommon/SoundStream.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/System.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
@@ -273,6 +276,46 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     ImGui::End();
   }
 
+  if (g_ActiveConfig.bShowAudioLatency)
+  {
+    const SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+    const Mixer* mixer = sound_stream ? sound_stream->GetMixer() : nullptr;
+    const Mixer::LatencyStatistics latency =
+        mixer ? mixer->GetLatencyStatistics() : Mixer::LatencyStatistics{};
+
+    // Position in the top-right corner of the screen.
+    int count = 3 + (latency.surround_active ? 3 : 0) + (latency.stretch_active ? 1 : 0);
+    float window_height = (12.f + 17.f * count) * backbuffer_scale;
+
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), set_next_position_condition,
+                            ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("AudioLatencyStats", nullptr, imgui_flags))
+    {
+      clamp_window_position();
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Audio:%4.0fms", latency.latency_ms);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Target:%3.0fms", latency.target_ms);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Jitter:%3.0fms", latency.jitter_ms);
+      if (latency.surround_active)
+      {
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "DPL2:%5.0fus", latency.surround_callback_us);
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Peak:%5.0fus",
+                           latency.surround_peak_callback_us);
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Block:%4.0fus", latency.surround_decode_us);
+      }
+      if (latency.stretch_active)
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Tempo:%4.0f%%", 100.0f * latency.stretch_tempo);
+    }
+    ImGui::End();
+  }
+
   if (g_ActiveConfig.bShowFPS || g_ActiveConfig.bShowFTimes)
   {
     int count = g_ActiveConfig.bShowFPS + 2 * g_ActiveConfig.bShowFTimes;
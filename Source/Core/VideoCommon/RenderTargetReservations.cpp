@@ -0,0 +1,52 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/RenderTargetReservations.h"
+
+void RenderTargetReservations::Clear()
+{
+  m_reservations.clear();
+}
+
+void RenderTargetReservations::OnAllocated(const TextureConfig& config)
+{
+  m_reservations[config].allocations++;
+}
+
+void RenderTargetReservations::EndFrame()
+{
+  for (auto iter = m_reservations.begin(); iter != m_reservations.end();)
+  {
+    Reservation& reservation = iter->second;
+    if (reservation.allocations >= reservation.peak)
+    {
+      reservation.peak = reservation.allocations;
+      reservation.frames_since_peak = 0;
+    }
+    else if (++reservation.frames_since_peak >= RESERVATION_FRAMES)
+    {
+      reservation.peak = reservation.allocations;
+      reservation.frames_since_peak = 0;
+    }
+
+    if (reservation.peak == 0)
+    {
+      iter = m_reservations.erase(iter);
+      continue;
+    }
+
+    reservation.allocations = 0;
+    reservation.unclaimed = reservation.peak;
+    ++iter;
+  }
+}
+
+bool RenderTargetReservations::Claim(const TextureConfig& config)
+{
+  const auto iter = m_reservations.find(config);
+  if (iter == m_reservations.end() || iter->second.unclaimed == 0)
+    return false;
+
+  iter->second.unclaimed--;
+  return true;
+}
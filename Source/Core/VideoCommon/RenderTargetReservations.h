@@ -0,0 +1,48 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <unordered_map>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureConfig.h"
+
+// Decides how many pooled render targets of each config the texture cache keeps alive.
+//
+// Games often repeat the same EFB copies, but not on every frame, e.g. for effects that only run
+// every other frame or that pause during loads. The texture pool destroys textures after a few
+// unused frames, so such copies would keep destroying and recreating their render targets. This
+// remembers the most render targets of each config allocated in a single frame, and keeps up to
+// that many alive until no frame has needed them for RESERVATION_FRAMES frames.
+class RenderTargetReservations
+{
+public:
+  static constexpr u32 RESERVATION_FRAMES = 60;
+
+  void Clear();
+
+  void OnAllocated(const TextureConfig& config);
+
+  // Updates the reservations with the allocations of the frame that just ended
+  void EndFrame();
+
+  // Returns whether one more pooled render target of the given config should be kept alive. Each
+  // reservation can be claimed once per frame.
+  bool Claim(const TextureConfig& config);
+
+private:
+  struct Reservation
+  {
+    // Allocated during the current frame
+    u32 allocations = 0;
+    // The most allocated during one frame, which is dropped to a lower count once it hasn't been
+    // reached for RESERVATION_FRAMES frames
+    u32 peak = 0;
+    u32 frames_since_peak = 0;
+    // Left to claim during the current frame
+    u32 unclaimed = 0;
+  };
+
+  std::unordered_map<TextureConfig, Reservation> m_reservations;
+};
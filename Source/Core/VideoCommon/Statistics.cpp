@@ -90,14 +90,22 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Textures pooled", "%d (%zu kB)", num_textures_pooled,
+                 bytes_textures_pooled / 1024);
+  draw_statistic("Texture pool hits", "%d/%d", this_frame.num_texture_pool_hits,
+                 this_frame.num_texture_pool_hits + this_frame.num_texture_pool_misses);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
+  draw_statistic("Cached prims (DL)", "%d", this_frame.num_cached_dl_prims);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  draw_statistic("CPU cull checks", "%d", this_frame.num_cpu_cull_draws);
+  draw_statistic("CPU culled draws", "%d", this_frame.num_cpu_culled_draws);
+  draw_statistic("CPU culled vertices", "%d", this_frame.num_cpu_culled_vertices);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
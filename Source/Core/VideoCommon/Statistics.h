@@ -18,6 +18,8 @@ struct Statistics
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
+  int num_textures_pooled = 0;
+  size_t bytes_textures_pooled = 0;
 
   int num_vertex_loaders = 0;
 
@@ -56,7 +58,15 @@ struct Statistics
     int num_primitive_joins = 0;
     int num_draw_calls = 0;
 
+    int num_cpu_cull_draws = 0;
+    int num_cpu_culled_draws = 0;
+    int num_cpu_culled_vertices = 0;
+
     int num_dlists_called = 0;
+    int num_cached_dl_prims = 0;
+
+    int num_texture_pool_hits = 0;
+    int num_texture_pool_misses = 0;
 
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
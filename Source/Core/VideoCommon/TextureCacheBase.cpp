@@ -65,6 +65,19 @@ static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
 static int xfb_count = 0;
 
+// Approximate amount of video memory used by a texture with the given config
+static size_t GetTextureMemorySize(const TextureConfig& config)
+{
+  const bool compressed = AbstractTexture::IsCompressedFormat(config.format);
+  size_t size = 0;
+  for (u32 level = 0; level < config.levels; level++)
+  {
+    const u32 height = std::max(config.height >> level, 1u);
+    size += config.GetMipStride(level) * (compressed ? (height + 3) / 4 : height);
+  }
+  return size * config.layers * config.samples;
+}
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
@@ -143,6 +156,7 @@ void TextureCacheBase::Invalidate()
   m_textures_by_address.clear();
 
   m_texture_pool.clear();
+  m_render_target_reservations.Clear();
 }
 
 void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
@@ -214,10 +228,15 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
+  m_render_target_reservations.EndFrame();
+
+  size_t pool_bytes = 0;
   TexPool::iterator iter2 = m_texture_pool.begin();
   TexPool::iterator tcend2 = m_texture_pool.end();
   while (iter2 != tcend2)
   {
+    if (iter2->first.IsRenderTarget() && m_render_target_reservations.Claim(iter2->first))
+      iter2->second.frameCount = _frameCount;
     if (iter2->second.frameCount == FRAMECOUNT_INVALID)
     {
       iter2->second.frameCount = _frameCount;
@@ -228,9 +247,13 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
     else
     {
+      pool_bytes += GetTextureMemorySize(iter2->first);
       ++iter2;
     }
   }
+
+  g_stats.num_textures_pooled = static_cast<int>(m_texture_pool.size());
+  g_stats.bytes_textures_pooled = pool_bytes;
 }
 
 bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -2646,13 +2669,18 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 std::optional<TextureCacheBase::TexPoolEntry>
 TextureCacheBase::AllocateTexture(const TextureConfig& config)
 {
+  if (config.IsRenderTarget())
+    m_render_target_reservations.OnAllocated(config);
+
   TexPool::iterator iter = FindMatchingTextureFromPool(config);
   if (iter != m_texture_pool.end())
   {
     auto entry = std::move(iter->second);
     m_texture_pool.erase(iter);
+    INCSTAT(g_stats.this_frame.num_texture_pool_hits);
     return std::move(entry);
   }
+  INCSTAT(g_stats.this_frame.num_texture_pool_misses);
 
   std::unique_ptr<AbstractTexture> texture = g_gfx->CreateTexture(config);
   if (!texture)
@@ -25,6 +25,7 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/RenderTargetReservations.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -420,6 +421,9 @@ private:
   std::array<RcTcacheEntry, 8> m_bound_textures{};
 
   TexPool m_texture_pool;
+
+  // Keeps pooled render targets alive for EFB copies which don't happen on every frame
+  RenderTargetReservations m_render_target_reservations;
   u64 m_last_entry_id = 0;
 
   // Backup configuration values
@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -27,6 +28,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -75,6 +77,9 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+
+  // Cached display lists reference the loaders that were just destroyed.
+  OpcodeDecoder::ClearDisplayListCache();
 }
 
 void UpdateVertexArrayPointers()
@@ -373,6 +378,49 @@ static void CheckCPConfiguration(int vtx_attr_group)
   }
 }
 
+static bool HasIndexedAttributes(const TVtxDesc& vtx_desc)
+{
+  if (IsIndexed(vtx_desc.low.Position) || IsIndexed(vtx_desc.low.Normal))
+    return true;
+  for (u32 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    if (IsIndexed(vtx_desc.low.Color[i]))
+      return true;
+  }
+  for (u32 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    if (IsIndexed(vtx_desc.high.TexCoord[i]))
+      return true;
+  }
+  return false;
+}
+
+static void LoadCachedVertices(VertexLoaderBase* loader, const CachedVertexData& cached_data,
+                               u8* dst)
+{
+  std::memcpy(dst, cached_data.data.data(), cached_data.data.size());
+  position_cache = cached_data.position_cache;
+  position_matrix_index_cache = cached_data.position_matrix_index_cache;
+  normal_cache = cached_data.normal_cache;
+  tangent_cache = cached_data.tangent_cache;
+  binormal_cache = cached_data.binormal_cache;
+  loader->m_numLoadedVertices += cached_data.count;
+}
+
+static void StoreCachedVertices(VertexLoaderBase* loader, int count, int num_loaded, int stride,
+                                const u8* dst, CachedVertexData* cached_data)
+{
+  cached_data->loader = loader;
+  cached_data->count = count;
+  cached_data->num_loaded = num_loaded;
+  cached_data->data.assign(dst, dst + num_loaded * stride);
+  cached_data->position_cache = position_cache;
+  cached_data->position_matrix_index_cache = position_matrix_index_cache;
+  cached_data->normal_cache = normal_cache;
+  cached_data->tangent_cache = tangent_cache;
+  cached_data->binormal_cache = binormal_cache;
+}
+
 static bool CanSplit(OpcodeDecoder::Primitive primitive)
 {
   // Splitting is currently only implemented for the easy cases (individual lines/points/triangles)
@@ -390,7 +438,8 @@ static bool CanSplit(OpcodeDecoder::Primitive primitive)
 }
 
 template <bool IsPreprocess>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                CachedVertexData* cached_data)
 {
   if (count == 0) [[unlikely]]
     return 0;
@@ -438,15 +487,35 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
     const int stride = loader->m_native_vtx_decl.stride;
+    const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
+
+    // Only draws that aren't split are cached, so a single entry covers the whole command.
+    if (cached_data != nullptr &&
+        (count > max_vertices || HasIndexedAttributes(g_main_cp_state.vtx_desc)))
+    {
+      cached_data = nullptr;
+    }
+
     do
     {
-      const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
       const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      int num_loaded;
+      if (cached_data != nullptr && cached_data->loader == loader && cached_data->count == run)
+      {
+        num_loaded = cached_data->num_loaded;
+        LoadCachedVertices(loader, *cached_data, dst.GetPointer());
+        INCSTAT(g_stats.this_frame.num_cached_dl_prims);
+      }
+      else
+      {
+        num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+        if (cached_data != nullptr)
+          StoreCachedVertices(loader, run, num_loaded, stride, dst.GetPointer(), cached_data);
+      }
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
@@ -473,9 +542,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 }
 
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                                const u8* src);
+                                const u8* src, CachedVertexData* cached_data);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                               const u8* src);
+                               const u8* src, CachedVertexData* cached_data);
 
 NativeVertexFormat* GetCurrentVertexFormat()
 {
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
@@ -40,9 +41,30 @@ NativeVertexFormat* GetOrCreateMatchingFormat(const PortableVertexDeclaration& d
 // offsets set to the unused attributes.
 NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 
+// Output of a vertex loader, captured so that an unchanged display list can be replayed without
+// running the loader again.  Only filled for vertex formats without indexed attributes, since
+// only then the output depends on nothing but the raw vertex data and the loader itself.
+struct CachedVertexData
+{
+  VertexLoaderBase* loader = nullptr;
+  int count = 0;
+  int num_loaded = 0;
+  std::vector<u8> data;
+
+  // State of the zfreeze/normal/tangent caches after the loader ran
+  std::array<std::array<float, 4>, 3> position_cache{};
+  std::array<u32, 3> position_matrix_index_cache{};
+  std::array<float, 4> normal_cache{};
+  std::array<float, 4> tangent_cache{};
+  std::array<float, 4> binormal_cache{};
+};
+
 // Returns -1 if buf_size is insufficient, else the amount of bytes consumed
+// If cached_data is given, it is either used instead of running the vertex loader (if it was
+// captured with the same loader), or filled with the loader output for later calls.
 template <bool IsPreprocess = false>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                CachedVertexData* cached_data = nullptr);
 
 namespace detail
 {
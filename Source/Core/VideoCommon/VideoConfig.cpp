@@ -104,6 +104,7 @@ void VideoConfig::Refresh()
   bShowGraphs = Config::Get(Config::GFX_SHOW_GRAPHS);
   bShowSpeed = Config::Get(Config::GFX_SHOW_SPEED);
   bShowSpeedColors = Config::Get(Config::GFX_SHOW_SPEED_COLORS);
+  bShowAudioLatency = Config::Get(Config::GFX_SHOW_AUDIO_LATENCY);
   iPerfSampleUSec = Config::Get(Config::GFX_PERF_SAMP_WINDOW) * 1000;
   bLogRenderTimeToFile = Config::Get(Config::GFX_LOG_RENDER_TIME_TO_FILE);
   bOverlayStats = Config::Get(Config::GFX_OVERLAY_STATS);
@@ -114,6 +115,8 @@ void VideoConfig::Refresh()
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  iHiresTextureMemoryBudget = Config::Get(Config::GFX_HIRES_TEXTURE_MEMORY_BUDGET);
+  iHiresTextureLoaderThreads = Config::Get(Config::GFX_HIRES_TEXTURE_LOADER_THREADS);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bEnableGPUTextureDecoding = Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
@@ -137,6 +140,7 @@ void VideoConfig::Refresh()
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  bDisplayListCache = Config::Get(Config::GFX_DISPLAY_LIST_CACHE);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -256,6 +260,16 @@ u32 VideoConfig::GetShaderCompilerThreads() const
     return GetNumAutoShaderCompilerThreads();
 }
 
+u32 VideoConfig::GetHiresTextureLoaderThreads() const
+{
+  if (iHiresTextureLoaderThreads > 0)
+    return static_cast<u32>(iHiresTextureLoaderThreads);
+
+  // Automatic number. Loading is mostly decoding PNGs, so it scales with cores, but leave room
+  // for the CPU, GPU and shader compiler threads.
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 2, 8));
+}
+
 u32 VideoConfig::GetShaderPrecompilerThreads() const
 {
   // When using background compilation, always keep the same thread count.
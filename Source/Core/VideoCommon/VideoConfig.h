@@ -252,6 +252,7 @@ struct VideoConfig final
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
+  bool bShowAudioLatency = false;
   int iPerfSampleUSec = 0;
   bool bOverlayStats = false;
   bool bOverlayProjStats = false;
@@ -270,6 +271,8 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  int iHiresTextureMemoryBudget = 0;  // In MiB, 0 for automatic
+  int iHiresTextureLoaderThreads = 0;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
@@ -284,6 +287,7 @@ struct VideoConfig final
   bool bPerfQueriesEnable = false;
   bool bBBoxEnable = false;
   bool bCPUCull = false;
+  bool bDisplayListCache = false;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
@@ -392,6 +396,7 @@ struct VideoConfig final
   }
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
+  u32 GetHiresTextureLoaderThreads() const;
   u32 GetShaderPrecompilerThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
@@ -1,21 +1,65 @@
 // Copyright 2009 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "AudioCommon/Mixer.h"
+#include "AudioCommon/NullSoundStream.h"
+#include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCaptureLogger.h"
 #include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
 #include "Core/DSP/DSPDisassembler.h"
 #include "Core/DSP/DSPHost.h"
 #include "Core/DSP/DSPTables.h"
+#include "Core/HW/DSPLLE/DSPLLE.h"
+
+// The AX ucodes render 32 kHz stereo audio, 5 ms of it per frame on the GameCube and 3 ms of it
+// per frame on the Wii.
+constexpr u32 AX_OUTPUT_SAMPLE_RATE = 32000;
+constexpr u32 AX_OUTPUT_BYTES = AX_OUTPUT_SAMPLE_RATE / 200 * 2 * sizeof(s16);
+constexpr u32 AXWII_OUTPUT_BYTES = AX_OUTPUT_SAMPLE_RATE * 3 / 1000 * 2 * sizeof(s16);
+
+// The rate the mixer is pulled at, as a typical audio backend would.
+constexpr u32 MIXER_OUTPUT_SAMPLE_RATE = 48000;
+
+// Only set while a capture is replayed.
+static Mixer* s_mixer = nullptr;
+static u64 s_audio_frames = 0;
+static std::chrono::steady_clock::duration s_mix_time{};
+
+// The last DMA of the current frame that is as large as a frame of output. The AUX, LRS and
+// surround uploads of AX are just as large, but every AX ucode sends the main output last and then
+// interrupts the CPU, so the buffer that is left over when the interrupt comes is the audio.
+static std::vector<s16> s_frame_output;
+
+static void MixFrameOutput()
+{
+  const std::size_t frames = s_frame_output.size() / 2;
+  s_audio_frames += frames;
+
+  std::vector<s16> mixed(frames * MIXER_OUTPUT_SAMPLE_RATE / AX_OUTPUT_SAMPLE_RATE * 2);
+  const auto start = std::chrono::steady_clock::now();
+  s_mixer->PushSamples(s_frame_output.data(), frames);
+  s_mixer->Mix(mixed.data(), mixed.size() / 2);
+  s_mix_time += std::chrono::steady_clock::now() - start;
+
+  s_frame_output.clear();
+}
 
 // Stub out the dsplib host stuff, since this is just a simple cmdline tools.
+// Main memory is only accessed by DMAs, whose data the replayer fills in from the capture.
 u8 DSP::Host::ReadHostMemory(u32 addr)
 {
   return 0;
@@ -28,6 +72,13 @@ void DSP::Host::DMAToDSP(u16* dst, u32 addr, u32 size)
 }
 void DSP::Host::DMAFromDSP(const u16* src, u32 addr, u32 size)
 {
+  if (!s_mixer || (size != AX_OUTPUT_BYTES && size != AXWII_OUTPUT_BYTES))
+    return;
+
+  // The mixer takes samples in the byte order of main memory
+  s_frame_output.resize(size / sizeof(s16));
+  for (std::size_t i = 0; i < s_frame_output.size(); ++i)
+    s_frame_output[i] = static_cast<s16>(Common::swap16(src[i]));
 }
 void DSP::Host::OSD_AddMessage(std::string str, u32 ms)
 {
@@ -40,14 +91,21 @@ bool DSP::Host::IsWiiHost()
 {
   return false;
 }
+// The recompilers and the BLOOP handling depend on IRAM having been analyzed.
 void DSP::Host::CodeLoaded(DSPCore& dsp, u32 addr, size_t size)
 {
+  dsp.ClearIRAM();
+  dsp.DSPState().GetAnalyzer().Analyze(dsp.DSPState());
 }
 void DSP::Host::CodeLoaded(DSPCore& dsp, const u8* ptr, size_t size)
 {
+  dsp.ClearIRAM();
+  dsp.DSPState().GetAnalyzer().Analyze(dsp.DSPState());
 }
 void DSP::Host::InterruptRequest()
 {
+  if (s_mixer && !s_frame_output.empty())
+    MixFrameOutput();
 }
 
 static std::string CodeToHeader(const std::vector<u16>& code, const std::string& filename)
@@ -359,6 +417,177 @@ static bool PerformAssembly(const std::string& input_name, const std::string& ou
   return true;
 }
 
+// Compares the samples of two WAV files written by WaveFileWriter.
+static bool CompareAudio(const std::string& output_name, const std::string& golden_name)
+{
+  constexpr std::size_t HEADER_SIZE = 44;
+  constexpr std::size_t FRAME_SIZE = 2 * sizeof(s16);
+
+  std::string output;
+  std::string golden;
+  if (!File::ReadFileToString(output_name, output) || output.size() < HEADER_SIZE)
+  {
+    printf("Replay: Could not read the rendered audio from %s\n", output_name.c_str());
+    return false;
+  }
+  if (!File::ReadFileToString(golden_name, golden) || golden.size() < HEADER_SIZE)
+  {
+    printf("Replay: %s is not a WAV file\n", golden_name.c_str());
+    return false;
+  }
+
+  const auto [output_it, golden_it] = std::mismatch(output.begin() + HEADER_SIZE, output.end(),
+                                                    golden.begin() + HEADER_SIZE, golden.end());
+  if (output_it == output.end() && golden_it == golden.end())
+  {
+    fmt::print("The rendered audio matches {}\n", golden_name);
+    return true;
+  }
+
+  const std::size_t frame = (output_it - output.begin() - HEADER_SIZE) / FRAME_SIZE;
+  if (output_it == output.end() || golden_it == golden.end())
+  {
+    fmt::print("Replay: Rendered {} stereo samples, but {} has {}\n",
+               (output.size() - HEADER_SIZE) / FRAME_SIZE, golden_name,
+               (golden.size() - HEADER_SIZE) / FRAME_SIZE);
+  }
+  else
+  {
+    fmt::print("Replay: The rendered audio differs from {} from stereo sample {} on\n",
+               golden_name, frame);
+  }
+  return false;
+}
+
+static bool PerformReplay(const std::string& input_name, std::string output_name,
+                          const std::string& golden_name, DSP::DSPInitOptions::CoreType core_type)
+{
+  if (input_name.empty())
+  {
+    printf("Replay: Must specify input.\n");
+    return false;
+  }
+
+  // The audio has to be written somewhere to be compared
+  std::string temp_directory;
+  if (!golden_name.empty() && output_name.empty())
+  {
+    temp_directory = File::CreateTempDir();
+    if (temp_directory.empty())
+      return false;
+    output_name = temp_directory + DIR_SEP "replay.wav";
+  }
+
+  DSP::DSPInitOptions opts;
+  opts.core_type = core_type;
+  const std::string sys_dir = File::GetSysDirectory() + GC_SYS_DIR DIR_SEP;
+  if (!DSP::LLE::LoadDSPRom(opts.irom_contents.data(), sys_dir + DSP_IROM,
+                            DSP::DSP_IROM_BYTE_SIZE) ||
+      !DSP::LLE::LoadDSPRom(opts.coef_contents.data(), sys_dir + DSP_COEF,
+                            DSP::DSP_COEF_BYTE_SIZE))
+  {
+    printf("Replay: Could not load the DSP ROMs from %s\n", sys_dir.c_str());
+    return false;
+  }
+
+  // NullSound turns the mixer off by clearing its sample rate, which would leave nothing to
+  // benchmark, so it is set back to what an audio backend would use.
+  NullSound sound_stream;
+  sound_stream.Init();
+  Mixer* const mixer = sound_stream.GetMixer();
+  mixer->SetSampleRate(MIXER_OUTPUT_SAMPLE_RATE);
+  mixer->SetDMAInputSampleRateDivisor(Mixer::FIXED_SAMPLE_RATE_DIVIDEND / AX_OUTPUT_SAMPLE_RATE);
+  if (!output_name.empty())
+  {
+    File::Delete(output_name);
+    mixer->StartLogDSPAudio(output_name);
+  }
+
+  // The DSP core takes ownership of the capture logger.
+  auto* const replayer = new DSP::PCAPDSPCaptureReplayer(input_name);
+  if (!replayer->IsValid())
+  {
+    printf("Replay: %s is not a DSP capture\n", input_name.c_str());
+    delete replayer;
+    return false;
+  }
+  delete opts.capture_logger;
+  opts.capture_logger = replayer;
+
+  DSP::DSPCore dsp;
+  if (!dsp.Initialize(opts))
+  {
+    printf("Replay: Could not initialize the DSP\n");
+    return false;
+  }
+  dsp.Reset();
+  DSP::InitInstructionTable();
+  // Captures start when the DSP comes out of reset, which the CPU does by clearing the halt bit.
+  dsp.DSPState().control_reg &= ~DSP::CR_HALT;
+  s_mixer = mixer;
+  s_audio_frames = 0;
+  s_mix_time = {};
+  s_frame_output.clear();
+
+  // A DSP that doesn't access the hardware for this long is stuck, as every ucode polls the
+  // mailboxes while it waits for work.
+  constexpr int CYCLES_PER_SLICE = 0x1000;
+  constexpr u64 MAX_SLICES_WITHOUT_PROGRESS = 0x10000;
+
+  const auto start = std::chrono::steady_clock::now();
+  u64 slices = 0;
+  u64 last_progress_slice = 0;
+  u64 last_position = 0;
+  while (!replayer->IsFinished() && !replayer->HasDiverged() &&
+         slices - last_progress_slice < MAX_SLICES_WITHOUT_PROGRESS)
+  {
+    dsp.RunCycles(CYCLES_PER_SLICE);
+    slices++;
+    if (replayer->GetPosition() != last_position)
+    {
+      last_position = replayer->GetPosition();
+      last_progress_slice = slices;
+    }
+  }
+  const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const bool finished = replayer->IsFinished();
+  if (replayer->HasDiverged())
+    fmt::print("Replay: The DSP diverged from the capture at {}\n", replayer->GetDivergence());
+  else if (!finished)
+    fmt::print("Replay: The DSP stopped after {} packets\n", replayer->GetPosition());
+
+  const u64 cycles = slices * CYCLES_PER_SLICE;
+  fmt::print("Replayed {} packets and {} DSP cycles in {:.3f} s ({:.0f} cycles per second)\n",
+             replayer->GetPosition(), cycles, seconds, cycles / seconds);
+  if (s_audio_frames != 0)
+  {
+    const double samples_per_second = s_audio_frames / seconds;
+    const double mix_seconds = std::chrono::duration<double>(s_mix_time).count();
+    fmt::print("Rendered {} stereo samples, {:.0f} samples per second ({:.2f}x real time)\n",
+               s_audio_frames, samples_per_second, samples_per_second / AX_OUTPUT_SAMPLE_RATE);
+    fmt::print("Mixing took {:.3f} s ({:.0f} samples per second)\n", mix_seconds,
+               s_audio_frames / mix_seconds);
+  }
+  else
+  {
+    fmt::print("The DSP did not render any AX audio\n");
+  }
+
+  s_mixer = nullptr;
+  dsp.Shutdown();
+  mixer->StopLogDSPAudio();
+
+  bool matches = true;
+  if (finished && !golden_name.empty())
+    matches = CompareAudio(output_name, golden_name);
+  if (!temp_directory.empty())
+    File::DeleteDirRecursively(temp_directory);
+
+  return finished && matches;
+}
+
 static bool IsHelpFlag(const std::string& argument)
 {
   return argument == "--help" || argument == "-?";
@@ -375,12 +604,16 @@ static bool IsHelpFlag(const std::string& argument)
 //   dsptool [-f] -h asdf.h asdf.txt
 // Print results from DSPSpy register dump
 //   dsptool -p dsp_dump0.bin
+// Replay a DSP capture log through the LLE DSP and write the rendered audio:
+//   dsptool -r -o audio.wav dsp.pcap
+// Replay a DSP capture log and compare the rendered audio to an earlier rendering:
+//   dsptool -r -g golden.wav dsp.pcap
 int main(int argc, const char* argv[])
 {
   if (argc == 1 || (argc == 2 && IsHelpFlag(argv[1])))
   {
-    printf("USAGE: DSPTool [-?] [--help] [-f] [-d] [-m] [-p <FILE>] [-o <FILE>] [-h <FILE>] <DSP "
-           "ASSEMBLER FILE>\n");
+    printf("USAGE: DSPTool [-?] [--help] [-f] [-d] [-m] [-p <FILE>] [-r <FILE>] [-g <FILE>] "
+           "[-o <FILE>] [-h <FILE>] <DSP ASSEMBLER FILE>\n");
     printf("-? / --help: Prints this message\n");
     printf("-d: Disassemble\n");
     printf("-m: Input file contains a list of files (Header assembly only)\n");
@@ -393,6 +626,15 @@ int main(int argc, const char* argv[])
     printf("-pm <DUMP FILE>: Print results of DSPSpy register dump (convert PROD values)\n");
     printf("-psm <DUMP FILE>: Print results of DSPSpy register dump (convert PROD values/disable "
            "SR output)\n");
+    printf("-r <CAPTURE FILE>: Replay a DSP capture log with the DSP JIT, check the DSP output "
+           "against it, mix the rendered AX audio and report the rendering and mixing speed (-o "
+           "writes the rendered audio to a WAV file)\n");
+    printf("-ri <CAPTURE FILE>: Replay a DSP capture log with the DSP interpreter\n");
+    printf("-rc <CAPTURE FILE>: Replay a DSP capture log with the DSP cached interpreter\n");
+    printf("-g <WAV FILE>: Compare the audio rendered by a replay to a WAV file written by an "
+           "earlier replay\n");
+    printf("Replays only support captures of the LLE DSP, which are written when CaptureLog is "
+           "enabled in the [DSP] section of Dolphin.ini.\n");
 
     return 0;
   }
@@ -400,9 +642,12 @@ int main(int argc, const char* argv[])
   std::string input_name;
   std::string output_header_name;
   std::string output_name;
+  std::string golden_name;
 
   bool disassemble = false, compare = false, multiple = false, outputSize = false, force = false,
-       print_results = false, print_results_prodhack = false, print_results_srhack = false;
+       print_results = false, print_results_prodhack = false, print_results_srhack = false,
+       replay = false;
+  auto replay_core_type = DSP::DSPInitOptions::CoreType::JIT64;
   for (int i = 1; i < argc; i++)
   {
     const std::string argument = argv[i];
@@ -415,6 +660,11 @@ int main(int argc, const char* argv[])
       if (++i < argc)
         output_name = argv[i];
     }
+    else if (argument == "-g")
+    {
+      if (++i < argc)
+        golden_name = argv[i];
+    }
     else if (argument == "-h")
     {
       if (++i < argc)
@@ -456,6 +706,20 @@ int main(int argc, const char* argv[])
       print_results_srhack = true;
       print_results_prodhack = true;
     }
+    else if (argument == "-r")
+    {
+      replay = true;
+    }
+    else if (argument == "-ri")
+    {
+      replay = true;
+      replay_core_type = DSP::DSPInitOptions::CoreType::Interpreter;
+    }
+    else if (argument == "-rc")
+    {
+      replay = true;
+      replay_core_type = DSP::DSPInitOptions::CoreType::CachedInterpreter;
+    }
     else
     {
       if (!input_name.empty())
@@ -490,6 +754,11 @@ int main(int argc, const char* argv[])
     return 0;
   }
 
+  if (replay)
+  {
+    return PerformReplay(input_name, output_name, golden_name, replay_core_type) ? 0 : 1;
+  }
+
   if (disassemble)
   {
     if (!PerformDisassembly(input_name, output_name))
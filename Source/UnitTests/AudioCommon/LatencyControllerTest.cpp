@@ -0,0 +1,92 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "AudioCommon/LatencyController.h"
+#include "Common/CommonTypes.h"
+
+using AudioCommon::LatencyController;
+
+namespace
+{
+constexpr double MIN_MS = 10.0;
+constexpr double MAX_MS = 200.0;
+constexpr double PERIOD_MS = 10.0;
+
+void RunCallbacks(LatencyController* controller, int count, double interval_ms, bool underrun)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    controller->Update(std::chrono::duration_cast<DT>(DT_ms(interval_ms)), PERIOD_MS, underrun);
+  }
+}
+}  // namespace
+
+TEST(LatencyController, SettlesLowWithSteadyCallbacks)
+{
+  LatencyController controller(MIN_MS, MAX_MS);
+  EXPECT_EQ(MAX_MS, controller.GetTargetMs());
+
+  RunCallbacks(&controller, 100, PERIOD_MS, false);
+
+  EXPECT_EQ(0.0, controller.GetJitterMs());
+  EXPECT_DOUBLE_EQ(2 * PERIOD_MS, controller.GetTargetMs());
+}
+
+TEST(LatencyController, FollowsLateCallbacks)
+{
+  LatencyController controller(MIN_MS, MAX_MS);
+  RunCallbacks(&controller, 100, PERIOD_MS, false);
+
+  // One callback arriving 15 ms late raises the target right away
+  RunCallbacks(&controller, 1, PERIOD_MS + 15.0, false);
+  EXPECT_DOUBLE_EQ(15.0, controller.GetJitterMs());
+  const double raised_target = controller.GetTargetMs();
+  EXPECT_GE(raised_target, 2 * (PERIOD_MS + 15.0));
+
+  // Which is only slowly given back
+  RunCallbacks(&controller, 100, PERIOD_MS, false);
+  EXPECT_LT(controller.GetTargetMs(), raised_target);
+  EXPECT_GT(controller.GetTargetMs(), 2 * PERIOD_MS + 15.0);
+
+  RunCallbacks(&controller, 10000, PERIOD_MS, false);
+  EXPECT_NEAR(2 * PERIOD_MS, controller.GetTargetMs(), 0.01);
+}
+
+TEST(LatencyController, UnderrunsAddMargin)
+{
+  LatencyController controller(MIN_MS, MAX_MS);
+  RunCallbacks(&controller, 100, PERIOD_MS, false);
+  const double settled_target = controller.GetTargetMs();
+
+  RunCallbacks(&controller, 3, PERIOD_MS, true);
+  const double raised_target = controller.GetTargetMs();
+  EXPECT_GT(raised_target, settled_target);
+
+  // The margin is held for a while after the last underrun
+  RunCallbacks(&controller, 500, PERIOD_MS, false);
+  EXPECT_DOUBLE_EQ(raised_target, controller.GetTargetMs());
+
+  RunCallbacks(&controller, 10000, PERIOD_MS, false);
+  EXPECT_LT(controller.GetTargetMs(), raised_target);
+}
+
+TEST(LatencyController, StaysWithinLimits)
+{
+  LatencyController controller(MIN_MS, MAX_MS);
+
+  // Stalls and constant underruns can't push the target past the configured maximum
+  RunCallbacks(&controller, 200, 1000.0, true);
+  EXPECT_EQ(MAX_MS, controller.GetTargetMs());
+
+  controller.SetLimits(MIN_MS, 50.0);
+  EXPECT_EQ(50.0, controller.GetTargetMs());
+
+  // And once everything has calmed down, it doesn't go below the minimum
+  controller.SetLimits(30.0, MAX_MS);
+  RunCallbacks(&controller, 100000, PERIOD_MS, false);
+  EXPECT_EQ(30.0, controller.GetTargetMs());
+}
@@ -0,0 +1,177 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <FreeSurround/FreeSurroundDecoder.h>
+#include <gtest/gtest.h>
+
+#include "AudioCommon/SurroundDecoder.h"
+#include "Common/CommonTypes.h"
+
+using AudioCommon::SurroundDecoder;
+
+namespace
+{
+constexpr u32 SAMPLE_RATE = 48000;
+constexpr u32 BLOCK_SIZE = 512;
+constexpr std::size_t CALLBACK_FRAMES = 480;
+constexpr std::size_t CALLBACK_COUNT = 100;
+
+std::vector<s16> MakeInput(std::size_t num_frames)
+{
+  std::vector<s16> input(num_frames * 2);
+  for (std::size_t i = 0; i < num_frames; ++i)
+  {
+    input[i * 2] = static_cast<s16>(10000 * std::sin(i * 0.01));
+    input[i * 2 + 1] = static_cast<s16>(8000 * std::sin(i * 0.013 + 1));
+  }
+  return input;
+}
+
+// Decodes the whole input in one go, in the channel order of the surround decoder
+std::vector<float> DecodeDirectly(const std::vector<s16>& input)
+{
+  DPL2FSDecoder decoder;
+  decoder.Init(cs_5point1, BLOCK_SIZE, SAMPLE_RATE);
+
+  const std::size_t num_frames = input.size() / 2;
+  std::vector<float> output;
+  std::vector<float> block(BLOCK_SIZE * 2);
+  for (std::size_t start = 0; start + BLOCK_SIZE <= num_frames; start += BLOCK_SIZE)
+  {
+    for (std::size_t i = 0; i < block.size(); ++i)
+      block[i] = input[start * 2 + i] / static_cast<float>(std::numeric_limits<short>::max());
+    const float* decoded = decoder.decode(block.data());
+    for (std::size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+      for (const std::size_t channel : {0, 2, 1, 5, 3, 4})
+        output.push_back(decoded[i * 6 + channel]);
+    }
+  }
+  return output;
+}
+
+// The output of the FreeSurround decoder as it was before its decoding loop was optimized, taken
+// from the last of REFERENCE_BLOCKS blocks decoded from MakeReferenceInput(). Only every
+// REFERENCE_STRIDE-th value is kept, which visits every channel in turn.
+constexpr std::size_t REFERENCE_BLOCKS = 4;
+constexpr std::size_t REFERENCE_STRIDE = 67;
+constexpr std::array<float, 46> REFERENCE_OUTPUT = {
+    -0.390723139f, -0.0701567158f, 0.165112227f, 0.0264377221f, 0.0436743051f, 0.0f, 0.171729445f,
+    -0.0204744991f, -0.296145529f, -0.127214074f, -0.0248665214f, 0.0f, 0.121612445f, 0.09397237f,
+    -0.0454486683f, 0.17572625f, -0.0311902687f, 0.0f, -0.26664421f, -0.135541052f, -0.26409027f,
+    -0.110266089f, 0.0204366185f, 0.0f, 0.181629673f, 0.0989315659f, -0.110437624f, 0.00587936211f,
+    -0.0451459959f, 0.0f, -0.0197429527f, -0.0199175999f, 0.284825206f, 0.104074538f, 0.0549199283f,
+    0.0f, -0.0292135365f, -0.064628005f, 0.0318578817f, -0.133302152f, -0.0141799524f, 0.0f,
+    -0.0141136311f, 0.128622219f, 0.294421673f, 0.150019214f};
+// The same with bass redirection, with the cutoffs raised so that the LFE channel gets some bins
+constexpr std::array<float, 46> REFERENCE_BASS_REDIRECTION_OUTPUT = {
+    -0.25116834f, -0.0250584669f, 0.0381727628f, 0.00478349905f, 0.00917940587f, 0.356096387f,
+    0.056883581f, -0.00802167505f, -0.0637491196f, -0.0465492345f, 0.0102257365f, -0.376211017f,
+    0.156853929f, 0.0346857756f, 0.0622957721f, 0.0769029334f, -0.014094932f, -0.321933895f,
+    -0.202143848f, -0.0473318733f, -0.0252438113f, -0.0417513065f, 0.00115877716f, 0.209855318f,
+    0.0477232262f, 0.0373453163f, -0.0224048533f, -0.00179050607f, -0.0108181117f, -0.378400743f,
+    0.117157556f, -0.00692148786f, 0.0608161613f, 0.0447181426f, 0.0170566291f, 0.465712905f,
+    -0.103035256f, -0.0217606314f, -0.0629973784f, -0.0357740261f, -0.0182113573f, 0.204641417f,
+    -0.0431083962f, 0.0414995179f, 0.0399973243f, 0.0625459626f};
+
+// Two sines on each side, at different levels and phases, plus noise that is opposite on both
+// sides, so that the sound is spread all around
+std::vector<float> MakeReferenceInput()
+{
+  std::vector<float> input(REFERENCE_BLOCKS * BLOCK_SIZE * 2);
+  u32 seed = 1;
+  for (std::size_t i = 0; i < REFERENCE_BLOCKS * BLOCK_SIZE; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    const float noise = static_cast<float>((seed >> 16) & 0x7fff) / 0x8000 - 0.5f;
+    input[i * 2] =
+        static_cast<float>(0.5 * std::sin(i * 0.0576) + 0.2 * std::sin(i * 0.4058)) + 0.05f * noise;
+    input[i * 2 + 1] =
+        static_cast<float>(0.4 * std::sin(i * 0.0576 + 1.0) + 0.25 * std::sin(i * 0.0118)) -
+        0.05f * noise;
+  }
+  return input;
+}
+
+std::vector<float> DecodeReferenceInput(bool bass_redirection)
+{
+  DPL2FSDecoder decoder;
+  decoder.Init(cs_5point1, BLOCK_SIZE, SAMPLE_RATE);
+  decoder.set_bass_redirection(bass_redirection);
+  decoder.set_low_cutoff(200.0f / SAMPLE_RATE * 2);
+  decoder.set_high_cutoff(800.0f / SAMPLE_RATE * 2);
+
+  std::vector<float> input = MakeReferenceInput();
+  const float* decoded = nullptr;
+  for (std::size_t i = 0; i < REFERENCE_BLOCKS; ++i)
+    decoded = decoder.decode(&input[i * BLOCK_SIZE * 2]);
+
+  std::vector<float> output;
+  for (std::size_t i = 0; i < BLOCK_SIZE * 6; i += REFERENCE_STRIDE)
+    output.push_back(decoded[i]);
+  return output;
+}
+}  // namespace
+
+TEST(SurroundDecoder, MatchesReferenceDecoder)
+{
+  // The optimized decoder computes the same values in a different order, so it may only be off by
+  // rounding
+  constexpr float TOLERANCE = 1e-5f;
+
+  const std::vector<float> output = DecodeReferenceInput(false);
+  ASSERT_EQ(REFERENCE_OUTPUT.size(), output.size());
+  for (std::size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(REFERENCE_OUTPUT[i], output[i], TOLERANCE) << "sample " << i * REFERENCE_STRIDE;
+
+  const std::vector<float> bass_output = DecodeReferenceInput(true);
+  ASSERT_EQ(REFERENCE_BASS_REDIRECTION_OUTPUT.size(), bass_output.size());
+  for (std::size_t i = 0; i < bass_output.size(); ++i)
+  {
+    EXPECT_NEAR(REFERENCE_BASS_REDIRECTION_OUTPUT[i], bass_output[i], TOLERANCE)
+        << "sample " << i * REFERENCE_STRIDE;
+  }
+}
+
+TEST(SurroundDecoder, MatchesDirectDecoding)
+{
+  const std::vector<s16> input = MakeInput(CALLBACK_FRAMES * CALLBACK_COUNT);
+  const std::vector<float> expected = DecodeDirectly(input);
+
+  SurroundDecoder decoder(SAMPLE_RATE, BLOCK_SIZE);
+  std::vector<float> output(input.size() / 2 * 6);
+  for (std::size_t i = 0; i < CALLBACK_COUNT; ++i)
+  {
+    decoder.PutFrames(&input[i * CALLBACK_FRAMES * 2], CALLBACK_FRAMES);
+
+    // Wait for the worker thread to decode every whole block, like it would in time for a real
+    // audio callback
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (decoder.GetStatistics().undecoded_frames >= BLOCK_SIZE)
+    {
+      ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "callback " << i;
+      std::this_thread::yield();
+    }
+
+    decoder.ReceiveFrames(&output[i * CALLBACK_FRAMES * 6], CALLBACK_FRAMES);
+  }
+
+  const SurroundDecoder::Statistics statistics = decoder.GetStatistics();
+  EXPECT_EQ(0u, statistics.underruns);
+  EXPECT_GE(statistics.latency_frames, BLOCK_SIZE + CALLBACK_FRAMES);
+  EXPECT_LT(statistics.latency_frames, BLOCK_SIZE + 2 * CALLBACK_FRAMES);
+
+  // The output is silent until enough frames are in flight, and then it's the decoded input
+  const std::size_t silent_samples = statistics.latency_frames * 6;
+  for (std::size_t i = 0; i < silent_samples; ++i)
+    ASSERT_EQ(0.0f, output[i]) << "sample " << i;
+  for (std::size_t i = silent_samples; i < output.size(); ++i)
+    ASSERT_EQ(expected[i - silent_samples], output[i]) << "sample " << i;
+}
@@ -0,0 +1,115 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AudioCommon/Enums.h"
+#include "AudioCommon/TimeStretcher.h"
+#include "Common/CommonTypes.h"
+
+using AudioCommon::TimeStretcher;
+using AudioCommon::TimeStretchQuality;
+
+namespace
+{
+constexpr u32 SAMPLE_RATE = 48000;
+constexpr double FREQUENCY = 440.0;
+constexpr std::size_t CALLBACK_FRAMES = 480;
+constexpr std::size_t CALLBACK_COUNT = 200;
+
+struct StretchResult
+{
+  std::vector<s16> output;
+  std::size_t input_frames = 0;
+};
+
+// Pulls the output a callback at a time and feeds the stretcher a sine as it asks for more, like
+// the mixer does
+StretchResult Stretch(TimeStretchQuality quality, double tempo)
+{
+  TimeStretcher stretcher(SAMPLE_RATE, quality);
+  stretcher.SetTempo(tempo);
+
+  StretchResult result;
+  result.output.resize(CALLBACK_FRAMES * CALLBACK_COUNT * 2);
+  std::vector<s16> input;
+  for (std::size_t i = 0; i < CALLBACK_COUNT; ++i)
+  {
+    while (stretcher.GetAvailableFrames() < CALLBACK_FRAMES)
+    {
+      input.resize(stretcher.GetInputFramesNeeded() * 2);
+      for (std::size_t j = 0; j < input.size(); j += 2)
+      {
+        const double t = static_cast<double>(result.input_frames++) / SAMPLE_RATE;
+        input[j] = static_cast<s16>(10000 * std::sin(2 * std::numbers::pi * FREQUENCY * t));
+        input[j + 1] = input[j];
+      }
+      stretcher.PutFrames(input.data(), input.size() / 2);
+    }
+    EXPECT_EQ(CALLBACK_FRAMES,
+              stretcher.ReceiveFrames(&result.output[i * CALLBACK_FRAMES * 2], CALLBACK_FRAMES));
+  }
+  return result;
+}
+
+// Counts the upward zero crossings of the left channel, after the first second
+double MeasureFrequency(const std::vector<s16>& output)
+{
+  const std::size_t start = SAMPLE_RATE;
+  std::size_t crossings = 0;
+  for (std::size_t i = start + 1; i < output.size() / 2; ++i)
+  {
+    if (output[(i - 1) * 2] < 0 && output[i * 2] >= 0)
+      ++crossings;
+  }
+  return crossings * static_cast<double>(SAMPLE_RATE) / (output.size() / 2 - start);
+}
+}  // namespace
+
+TEST(TimeStretcher, KeepsPitch)
+{
+  for (const TimeStretchQuality quality :
+       {TimeStretchQuality::Low, TimeStretchQuality::Medium, TimeStretchQuality::High})
+  {
+    for (const double tempo : {0.5, 1.0, 1.5, 2.0, 4.0})
+    {
+      const StretchResult result = Stretch(quality, tempo);
+      EXPECT_NEAR(FREQUENCY, MeasureFrequency(result.output), FREQUENCY * 0.02)
+          << "quality " << static_cast<int>(quality) << ", tempo " << tempo;
+    }
+  }
+}
+
+TEST(TimeStretcher, ConsumesInputAtTempo)
+{
+  for (const double tempo : {0.5, 1.0, 2.0, 4.0})
+  {
+    const StretchResult result = Stretch(TimeStretchQuality::Medium, tempo);
+
+    // Besides the input for the given tempo, the stretcher only holds on to about one segment and
+    // its search range
+    const double expected = tempo * result.output.size() / 2;
+    EXPECT_GE(result.input_frames, expected) << "tempo " << tempo;
+    EXPECT_LT(result.input_frames, expected + SAMPLE_RATE * 0.1 * std::max(tempo, 1.0))
+        << "tempo " << tempo;
+  }
+}
+
+TEST(TimeStretcher, SilenceStaysSilent)
+{
+  TimeStretcher stretcher(SAMPLE_RATE, TimeStretchQuality::High);
+  stretcher.SetTempo(1.5);
+
+  const std::vector<s16> input(SAMPLE_RATE * 2, 0);
+  stretcher.PutFrames(input.data(), SAMPLE_RATE);
+  ASSERT_GT(stretcher.GetAvailableFrames(), 0u);
+
+  std::vector<s16> output(stretcher.GetAvailableFrames() * 2, 1);
+  stretcher.ReceiveFrames(output.data(), output.size() / 2);
+  for (const s16 sample : output)
+    ASSERT_EQ(0, sample);
+}
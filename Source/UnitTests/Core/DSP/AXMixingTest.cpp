@@ -0,0 +1,110 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+constexpr u32 MAX_COUNT = 96;
+
+// The loops AXVoice.h used before the kernels were vectorized
+u16 ReferenceScaleSamples(s16* output, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                          bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 factor = signed_volume ? s32(s16(volume)) : s32(volume);
+    const s64 sample = (s64(input[i]) * factor) >> 15;
+    output[i] = static_cast<s16>(std::clamp<s64>(sample, -0x8000, 0x7FFF));
+    volume += volume_delta;
+  }
+  return volume;
+}
+
+std::array<s16, MAX_COUNT> RandomSamples(std::mt19937& rng)
+{
+  std::uniform_int_distribution<int> distribution(-0x8000, 0x7FFF);
+  std::array<s16, MAX_COUNT> samples;
+  for (s16& sample : samples)
+    sample = static_cast<s16>(distribution(rng));
+  // Make sure the extremes are covered
+  samples[0] = -0x8000;
+  samples[1] = 0x7FFF;
+  return samples;
+}
+}  // namespace
+
+TEST(AXMixing, ScaleSamplesIsBitExact)
+{
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> distribution(0, 0xFFFF);
+
+  constexpr std::array<u16, 6> interesting_volumes = {0, 1, 0x7FFF, 0x8000, 0x8001, 0xFFFF};
+  for (const bool signed_volume : {false, true})
+  {
+    for (int iteration = 0; iteration < 500; ++iteration)
+    {
+      const auto input = RandomSamples(rng);
+      const u16 volume = iteration < static_cast<int>(interesting_volumes.size()) ?
+                             interesting_volumes[iteration] :
+                             static_cast<u16>(distribution(rng));
+      // Small deltas like the ones games use, and large ones which make the volume wrap around
+      const u16 volume_delta =
+          static_cast<u16>(iteration % 2 ? distribution(rng) : distribution(rng) % 64 - 32);
+      // Cover counts which aren't a multiple of the vector width
+      const u32 count = iteration % (MAX_COUNT + 1);
+
+      std::array<s16, MAX_COUNT> expected{};
+      std::array<s16, MAX_COUNT> actual{};
+      const u16 expected_volume = ReferenceScaleSamples(expected.data(), input.data(), count,
+                                                        volume, volume_delta, signed_volume);
+      const u16 actual_volume = AXMixing::ScaleSamples(actual.data(), input.data(), count, volume,
+                                                       volume_delta, signed_volume);
+
+      EXPECT_EQ(expected_volume, actual_volume);
+      EXPECT_EQ(expected, actual) << "volume " << volume << " delta " << volume_delta << " count "
+                                  << count << " signed " << signed_volume;
+    }
+  }
+}
+
+TEST(AXMixing, ScaleSamplesInPlace)
+{
+  std::mt19937 rng(5678);
+  auto samples = RandomSamples(rng);
+
+  std::array<s16, MAX_COUNT> expected;
+  ReferenceScaleSamples(expected.data(), samples.data(), MAX_COUNT, 0x9000, 0xFFF0, false);
+  AXMixing::ScaleSamples(samples.data(), samples.data(), MAX_COUNT, 0x9000, 0xFFF0, false);
+
+  EXPECT_EQ(expected, samples);
+}
+
+TEST(AXMixing, AddSamples)
+{
+  std::mt19937 rng(9012);
+  const auto input = RandomSamples(rng);
+
+  for (u32 count = 0; count <= MAX_COUNT; ++count)
+  {
+    std::array<int, MAX_COUNT> expected;
+    for (u32 i = 0; i < MAX_COUNT; ++i)
+      expected[i] = static_cast<int>(i * 1000) - 50000;
+    auto actual = expected;
+
+    for (u32 i = 0; i < count; ++i)
+      expected[i] += input[i];
+    AXMixing::AddSamples(actual.data(), input.data(), count);
+
+    EXPECT_EQ(expected, actual) << "count " << count;
+  }
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -187,3 +189,79 @@ TEST(DSPAccelerator, CurrentAddressSkips)
   accelerator.TestRead();
   EXPECT_EQ(accelerator.GetCurrentAddress(), 0x00000013u);
 }
+
+// Accelerator reading from actual memory, which loops like the AX ucodes make it loop
+class MemoryAccelerator : public DSP::Accelerator
+{
+public:
+  explicit MemoryAccelerator(const std::vector<u8>& memory) : m_memory(memory) {}
+
+protected:
+  void OnRawReadEndException() override {}
+  void OnRawWriteEndException() override {}
+  void OnSampleReadEndException() override
+  {
+    SetPredScale(m_memory[(m_start_address & ~15) >> 1]);
+    SetYn1(0x1234);
+    SetYn2(-0x1234);
+  }
+  u8 ReadMemory(u32 address) override { return m_memory[address % m_memory.size()]; }
+  void WriteMemory(u32 address, u8 value) override {}
+
+private:
+  const std::vector<u8>& m_memory;
+};
+
+TEST(DSPAccelerator, ReadSamplesMatchesReadSample)
+{
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> byte_distribution(0, 0xff);
+  std::vector<u8> memory(0x200);
+  for (u8& byte : memory)
+    byte = static_cast<u8>(byte_distribution(rng));
+
+  std::array<s16, 16> coefs;
+  std::uniform_int_distribution<int> coef_distribution(-0x8000, 0x7fff);
+  for (s16& coef : coefs)
+    coef = static_cast<s16>(coef_distribution(rng));
+
+  std::uniform_int_distribution<u32> address_distribution(0, 0x3ff);
+  std::uniform_int_distribution<u32> count_distribution(0, 100);
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const u32 start = address_distribution(rng);
+    // Cover all of the special cases for the lower bits of the end address
+    const u32 end = ((start + address_distribution(rng)) & ~15) | (iteration & 15);
+    // Mostly ADPCM, but also the other formats, which are left to ReadSample
+    const u16 format = iteration % 8 == 0 ? static_cast<u16>(byte_distribution(rng)) : 0;
+    const s16 yn1 = static_cast<s16>(coef_distribution(rng));
+    const s16 yn2 = static_cast<s16>(coef_distribution(rng));
+
+    MemoryAccelerator expected(memory);
+    MemoryAccelerator actual(memory);
+    for (MemoryAccelerator* accelerator : {&expected, &actual})
+    {
+      accelerator->SetStartAddress(start);
+      accelerator->SetEndAddress(end);
+      accelerator->SetCurrentAddress(start + iteration % 32);
+      accelerator->SetSampleFormat(format);
+      accelerator->SetPredScale(static_cast<u16>(iteration));
+      accelerator->SetYn1(yn1);
+      accelerator->SetYn2(yn2);
+      accelerator->SetGain(0x800);
+    }
+
+    const u32 count = count_distribution(rng);
+    std::vector<s16> expected_samples(count);
+    std::vector<s16> actual_samples(count);
+    for (s16& sample : expected_samples)
+      sample = static_cast<s16>(expected.ReadSample(coefs.data()));
+    actual.ReadSamples(actual_samples.data(), count, coefs.data());
+
+    EXPECT_EQ(expected_samples, actual_samples) << "iteration " << iteration;
+    EXPECT_EQ(expected.GetCurrentAddress(), actual.GetCurrentAddress());
+    EXPECT_EQ(expected.GetYn1(), actual.GetYn1());
+    EXPECT_EQ(expected.GetYn2(), actual.GetYn2());
+    EXPECT_EQ(expected.GetPredScale(), actual.GetPredScale());
+  }
+}
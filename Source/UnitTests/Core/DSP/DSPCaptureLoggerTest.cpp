@@ -0,0 +1,251 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/MemoryUtil.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCaptureLogger.h"
+#include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/HW/DSPLLE/DSPLLE.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+
+using namespace DSP;
+
+namespace
+{
+constexpr u16 CMBH = 0xfffe;
+constexpr u16 DSCR = 0xffc9;
+constexpr std::array<u8, 4> DMA_IN_DATA = {1, 2, 3, 4};
+constexpr std::array<u8, 4> DMA_OUT_DATA = {5, 6, 7, 8};
+
+// Loads a ucode over code that has already run and jumps to it through a register, like the ROM
+// does when it boots the next ucode, so the recompilers have to forget the old code. The ucode
+// mixes the mail it reads into the mails it sends from a BLOOP, which only repeats once the new
+// code has been analyzed.
+constexpr char BOOT_TEXT[] = R"(
+	lri	$AR3, #ucode
+	callr	$AR3
+	si	@0xffce, #0x0000
+	si	@0xffcf, #0x1000
+	si	@0xffcd, #ucode
+	si	@0xffc9, #0x0002
+	si	@0xffcb, #0x0020
+	callr	$AR3
+	halt
+	org	0x0010
+ucode:
+	ret
+)";
+
+constexpr char UCODE_TEXT[] = R"(
+	org	0x0010
+	clr	$ACC0
+	lr	$AC1.M, @0xffff
+	lri	$AR0, #0xfffd
+	bloopi	#4, loop_end
+	add	$ACC0, $ACC1
+loop_end:
+	srr	@$AR0, $AC0.M
+	ret
+)";
+
+constexpr u32 UCODE_GC_ADDRESS = 0x1000;
+constexpr u16 UCODE_IRAM_ADDRESS = 0x0010;
+}  // namespace
+
+class DSPCaptureLoggerTest : public testing::Test
+{
+protected:
+  DSPCaptureLoggerTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/dsp.pcap")
+  {
+    PCAPDSPCaptureLogger logger(m_path);
+    logger.LogIFXRead(CMBH, 0x8000);
+    logger.LogIFXWrite(DSCR, 0x0000);
+    logger.LogDMA(0x0000, 0x80001000, 0x0000, DMA_IN_DATA.size(), DMA_IN_DATA.data());
+    logger.LogDMA(0x0001, 0x80002000, 0x0010, DMA_OUT_DATA.size(), DMA_OUT_DATA.data());
+  }
+
+  ~DSPCaptureLoggerTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  const std::string m_directory;
+  const std::string m_path;
+};
+
+TEST_F(DSPCaptureLoggerTest, ReplaysCapture)
+{
+  PCAPDSPCaptureReplayer replayer(m_path);
+  ASSERT_TRUE(replayer.IsValid());
+
+  EXPECT_EQ(0x8000, replayer.FilterIFXRead(CMBH, 0x0000));
+  replayer.LogIFXRead(CMBH, 0x8000);
+  replayer.LogIFXWrite(DSCR, 0x0000);
+
+  std::array<u16, 2> dram{};
+  replayer.FilterDMAToDSP(dram.data(), 0x80001000, DMA_IN_DATA.size());
+  const u8* dram_bytes = reinterpret_cast<const u8*>(dram.data());
+  EXPECT_TRUE(std::equal(DMA_IN_DATA.begin(), DMA_IN_DATA.end(), dram_bytes));
+  replayer.LogDMA(0x0000, 0x80001000, 0x0000, DMA_IN_DATA.size(), dram_bytes);
+  replayer.LogDMA(0x0001, 0x80002000, 0x0010, DMA_OUT_DATA.size(), DMA_OUT_DATA.data());
+
+  EXPECT_FALSE(replayer.HasDiverged()) << replayer.GetDivergence();
+  EXPECT_TRUE(replayer.IsFinished());
+  EXPECT_EQ(4u, replayer.GetPosition());
+
+  // Reads past the end of the capture come from the hardware
+  EXPECT_EQ(0x1234, replayer.FilterIFXRead(CMBH, 0x1234));
+}
+
+TEST_F(DSPCaptureLoggerTest, StopsAtFirstDifference)
+{
+  PCAPDSPCaptureReplayer replayer(m_path);
+  ASSERT_TRUE(replayer.IsValid());
+
+  replayer.LogIFXRead(CMBH, 0x8000);
+  replayer.LogIFXWrite(DSCR, 0x0000);
+  replayer.LogDMA(0x0000, 0x80001000, 0x0000, DMA_IN_DATA.size(), DMA_IN_DATA.data());
+  replayer.LogDMA(0x0001, 0x80002000, 0x0010, DMA_IN_DATA.size(), DMA_IN_DATA.data());
+
+  EXPECT_TRUE(replayer.HasDiverged());
+  EXPECT_FALSE(replayer.IsFinished());
+  EXPECT_EQ(3u, replayer.GetPosition());
+  EXPECT_NE(std::string::npos, replayer.GetDivergence().find("different data"));
+
+  // Once diverged, the replay doesn't feed the DSP anymore
+  EXPECT_EQ(0x1234, replayer.FilterIFXRead(CMBH, 0x1234));
+}
+
+TEST_F(DSPCaptureLoggerTest, RejectsOtherFiles)
+{
+  ASSERT_TRUE(File::WriteStringToFile(m_path, "not a capture"));
+  EXPECT_FALSE(PCAPDSPCaptureReplayer(m_path).IsValid());
+}
+
+// Runs the boot code on a core which sends its accesses to a capture logger
+class BootRunner
+{
+public:
+  // Takes ownership of the capture logger
+  bool Initialize(DSPInitOptions::CoreType core_type, DSPCaptureLogger* capture_logger)
+  {
+    DSPInitOptions options;
+    options.core_type = core_type;
+    delete options.capture_logger;
+    options.capture_logger = capture_logger;
+    const std::string sys_dir = File::GetSysDirectory() + GC_SYS_DIR DIR_SEP;
+    if (!LLE::LoadDSPRom(options.irom_contents.data(), sys_dir + DSP_IROM, DSP_IROM_BYTE_SIZE) ||
+        !LLE::LoadDSPRom(options.coef_contents.data(), sys_dir + DSP_COEF, DSP_COEF_BYTE_SIZE))
+    {
+      delete capture_logger;
+      return false;
+    }
+
+    m_initialized = m_core.Initialize(options);
+    InitInstructionTable();
+    return m_initialized;
+  }
+
+  ~BootRunner()
+  {
+    if (m_initialized)
+      m_core.Shutdown();
+  }
+
+  void Run()
+  {
+    std::vector<u16> boot;
+    ASSERT_TRUE(Assemble(BOOT_TEXT, boot));
+
+    SDSP& state = m_core.DSPState();
+    Common::UnWriteProtectMemory(state.iram, DSP_IRAM_BYTE_SIZE, false);
+    std::ranges::copy(boot, state.iram);
+    Common::WriteProtectMemory(state.iram, DSP_IRAM_BYTE_SIZE, false);
+    m_core.ClearIRAM();
+    state.GetAnalyzer().Analyze(state);
+
+    state.pc = 0;
+    state.control_reg &= ~(CR_HALT | CR_INIT);
+    for (int i = 0; i < 100 && (state.control_reg & CR_HALT) == 0; i++)
+      m_core.RunCycles(1000);
+    EXPECT_NE(0, state.control_reg & CR_HALT);
+  }
+
+  DSPCore& GetCore() { return m_core; }
+
+private:
+  DSPCore m_core;
+  bool m_initialized = false;
+};
+
+class DSPReplayTest : public testing::Test
+{
+protected:
+  DSPReplayTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/dsp.pcap")
+  {
+    Core::System::GetInstance().GetMemory().Init();
+  }
+
+  ~DSPReplayTest() override
+  {
+    Core::System::GetInstance().GetMemory().Shutdown();
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  const std::string m_directory;
+  const std::string m_path;
+};
+
+TEST_F(DSPReplayTest, ReplaysLoadedUcode)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+  std::vector<u16> ucode;
+  ASSERT_TRUE(Assemble(UCODE_TEXT, ucode));
+  ucode.erase(ucode.begin(), ucode.begin() + UCODE_IRAM_ADDRESS);
+  memory.CopyToEmuSwapped(UCODE_GC_ADDRESS, ucode.data(), ucode.size() * sizeof(u16));
+
+  {
+    BootRunner runner;
+    ASSERT_TRUE(runner.Initialize(DSPInitOptions::CoreType::Interpreter,
+                                  new PCAPDSPCaptureLogger(m_path)));
+    runner.GetCore().WriteMailboxHigh(Mailbox::CPU, 0x8000);
+    runner.GetCore().WriteMailboxLow(Mailbox::CPU, 0x0003);
+    runner.Run();
+    EXPECT_EQ(4 * 0x0003, runner.GetCore().ReadMailboxLow(Mailbox::DSP));
+  }
+
+  // Neither the ucode nor the mail may come from anywhere else than the capture
+  memory.Clear();
+
+  for (const auto core_type : {
+#ifdef _M_X86_64
+           DSPInitOptions::CoreType::JIT64,
+#endif
+           DSPInitOptions::CoreType::CachedInterpreter, DSPInitOptions::CoreType::Interpreter})
+  {
+    SCOPED_TRACE(static_cast<int>(core_type));
+    auto* const replayer = new PCAPDSPCaptureReplayer(m_path);
+    ASSERT_TRUE(replayer->IsValid());
+
+    BootRunner runner;
+    ASSERT_TRUE(runner.Initialize(core_type, replayer));
+    runner.Run();
+    EXPECT_FALSE(replayer->HasDiverged()) << replayer->GetDivergence();
+    EXPECT_TRUE(replayer->IsFinished());
+  }
+}
@@ -0,0 +1,230 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/MemoryUtil.h"
+#include "Common/Swap.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+
+using namespace DSP;
+
+namespace
+{
+// Mixes 16 voices of 160 samples into one buffer, like the inner loops of the AX uCodes. Most of
+// the time is spent in a BLOOPI body which ends the block on every iteration.
+constexpr char MIXING_TEXT[] = R"(
+	clr	$ACC0
+	lri	$AC0.M, #16
+voice_loop:
+	lri	$AR0, #0x0000
+	lri	$AR1, #0x0400
+	lri	$AX0.H, #0x4000
+	bloopi	#160, mix_end
+	clr	$ACC1
+	lrri	$AX0.L, @$AR0
+	mul	$AX0.L, $AX0.H
+	lrr	$AC1.M, @$AR1
+	addp	$ACC1
+mix_end:
+	srri	@$AR1, $AC1.M
+	decm	$AC0.M
+	jnz	voice_loop
+	halt
+)";
+
+// Calls short subroutines from a loop, like the command dispatchers of the Zelda and AX uCodes.
+// Every CALL and RET leaves its block.
+constexpr char DISPATCH_TEXT[] = R"(
+	clr	$ACC0
+	clr	$ACC1
+	lri	$AC0.M, #2000
+	lri	$AR0, #0x0800
+loop:
+	call	accumulate
+	call	store
+	decm	$AC0.M
+	jnz	loop
+	halt
+accumulate:
+	addis	$AC1.M, #3
+	tst	$ACC1
+	retnz
+	ret
+store:
+	srri	@$AR0, $AC1.M
+	ret
+)";
+
+struct Ucode
+{
+  const char* name;
+  const char* text;
+};
+
+constexpr Ucode UCODES[] = {{"mixing", MIXING_TEXT}, {"dispatch", DISPATCH_TEXT}};
+
+struct Core
+{
+  const char* name;
+  DSPInitOptions::CoreType type;
+};
+
+constexpr Core RECOMPILERS[] = {
+#ifdef _M_X86_64
+    {"JIT", DSPInitOptions::CoreType::JIT64},
+#endif
+    {"cached interpreter", DSPInitOptions::CoreType::CachedInterpreter},
+};
+
+bool LoadRom(std::span<u16> rom, const char* filename)
+{
+  std::string bytes;
+  if (!File::ReadFileToString(File::GetSysDirectory() + GC_SYS_DIR DIR_SEP + filename, bytes) ||
+      bytes.size() != rom.size_bytes())
+  {
+    return false;
+  }
+
+  std::memcpy(rom.data(), bytes.data(), rom.size_bytes());
+  for (u16& word : rom)
+    word = Common::swap16(word);
+  return true;
+}
+
+class DSPRunner
+{
+public:
+  bool Initialize(DSPInitOptions::CoreType core_type)
+  {
+    DSPInitOptions options;
+    options.core_type = core_type;
+    if (!LoadRom(options.irom_contents, DSP_IROM) || !LoadRom(options.coef_contents, DSP_COEF))
+      return false;
+
+    m_initialized = m_core.Initialize(options);
+    InitInstructionTable();
+    return m_initialized;
+  }
+
+  ~DSPRunner()
+  {
+    if (m_initialized)
+      m_core.Shutdown();
+  }
+
+  // Starts executing the given code from the start of IRAM, without going through the ROM
+  void Load(const std::vector<u16>& code)
+  {
+    SDSP& state = m_core.DSPState();
+    Common::UnWriteProtectMemory(state.iram, DSP_IRAM_BYTE_SIZE, false);
+    std::ranges::copy(code, state.iram);
+    Common::WriteProtectMemory(state.iram, DSP_IRAM_BYTE_SIZE, false);
+    m_core.ClearIRAM();
+    state.GetAnalyzer().Analyze(state);
+
+    Restart();
+  }
+
+  void Restart()
+  {
+    SDSP& state = m_core.DSPState();
+    state.pc = 0;
+    state.control_reg &= ~(CR_HALT | CR_INIT);
+  }
+
+  void RunUntilHalted()
+  {
+    while ((m_core.DSPState().control_reg & CR_HALT) == 0)
+      m_core.RunCycles(1000);
+  }
+
+  const SDSP& GetState() { return m_core.DSPState(); }
+
+private:
+  DSPCore m_core;
+  bool m_initialized = false;
+};
+
+std::vector<u16> Assemble(const char* text)
+{
+  std::vector<u16> code;
+  EXPECT_TRUE(DSP::Assemble(text, code));
+  return code;
+}
+
+// The PC isn't compared, as the JIT's HALT doesn't leave it on the HALT like the interpreter does
+void ExpectSameState(const SDSP& expected, const SDSP& actual)
+{
+  EXPECT_EQ(0, std::memcmp(&expected.r, &actual.r, sizeof(expected.r)));
+  EXPECT_TRUE(std::equal(expected.dram, expected.dram + DSP_DRAM_SIZE, actual.dram));
+}
+}  // namespace
+
+TEST(DSPAnalyzer, FindsMailboxPollingLoops)
+{
+  DSPRunner runner;
+  ASSERT_TRUE(runner.Initialize(DSPInitOptions::CoreType::Interpreter));
+
+  runner.Load(Assemble(R"(
+	nop
+poll_cpu:
+	lr	$AC1.M, @0xfffe
+	andcf	$AC1.M, #0x8000
+	jlnz	poll_cpu
+	nop
+poll_dsp:
+	lrs	$AC0.M, @0xfffc
+	andf	$AC0.M, #0x8000
+	jlnz	poll_dsp
+	nop
+not_a_mailbox:
+	lr	$AC0.M, @0x0010
+	andcf	$AC0.M, #0x8000
+	jlnz	not_a_mailbox
+	halt
+)"));
+
+  const Analyzer& analyzer = runner.GetState().GetAnalyzer();
+  EXPECT_FALSE(analyzer.IsIdleSkip(0));
+  EXPECT_TRUE(analyzer.IsIdleSkip(1));
+  EXPECT_TRUE(analyzer.IsIdleSkip(8));
+  EXPECT_FALSE(analyzer.IsIdleSkip(14));
+}
+
+TEST(DSPJit, MatchesInterpreter)
+{
+  for (const Ucode& ucode : UCODES)
+  {
+    SCOPED_TRACE(ucode.name);
+    const std::vector<u16> code = Assemble(ucode.text);
+
+    DSPRunner interpreter;
+    ASSERT_TRUE(interpreter.Initialize(DSPInitOptions::CoreType::Interpreter));
+    interpreter.Load(code);
+    interpreter.RunUntilHalted();
+
+    for (const Core& core : RECOMPILERS)
+    {
+      SCOPED_TRACE(core.name);
+      DSPRunner recompiler;
+      ASSERT_TRUE(recompiler.Initialize(core.type));
+      recompiler.Load(code);
+      recompiler.RunUntilHalted();
+
+      ExpectSameState(interpreter.GetState(), recompiler.GetState());
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/SymbolDB.h"
+#include "Core/Debugger/GuestProfiler.h"
+#include "Core/System.h"
+
+namespace
+{
+class TestSymbolDB final : public Common::SymbolDB
+{
+public:
+  TestSymbolDB()
+  {
+    Add(0x80001000, 0x100, "main");
+    Add(0x80002000, 0x100, "update");
+    Add(0x80003000, 0x100, "draw;list");
+  }
+
+  const Common::Symbol* GetSymbolFromAddr(u32 addr) const override
+  {
+    auto it = m_symbols.upper_bound(addr);
+    if (it == m_symbols.begin())
+      return nullptr;
+    --it;
+    return addr < it->second.address + it->second.size ? &it->second : nullptr;
+  }
+
+private:
+  void Add(u32 address, u32 size, const std::string& name)
+  {
+    Common::Symbol symbol(name);
+    symbol.address = address;
+    symbol.size = size;
+    m_symbols.emplace(address, std::move(symbol));
+  }
+
+  std::map<u32, Common::Symbol> m_symbols;
+};
+
+std::string ReadBack(std::FILE* file)
+{
+  std::rewind(file);
+  std::string contents;
+  for (int c; (c = std::fgetc(file)) != EOF;)
+    contents.push_back(static_cast<char>(c));
+  std::fclose(file);
+  return contents;
+}
+}  // namespace
+
+TEST(GuestProfiler, MergesFramesOfTheSameFunction)
+{
+  const TestSymbolDB symbol_db;
+  Core::GuestProfiler profiler(Core::System::GetInstance());
+
+  // PC and LR inside update, called from main
+  profiler.AddSample(symbol_db, std::array<u32, 3>{0x80002010, 0x80002040, 0x80001080}, 100);
+  // Same stack, sampled at a different PC
+  profiler.AddSample(symbol_db, std::array<u32, 2>{0x80002020, 0x80001080}, 50);
+  // Unknown code called from main
+  profiler.AddSample(symbol_db, std::array<u32, 2>{0x90000000, 0x80001080}, 25);
+
+  const auto& stacks = profiler.GetStacks();
+  ASSERT_EQ(2u, stacks.size());
+
+  const auto update = stacks.find({0x80002000, 0x80001000});
+  ASSERT_NE(stacks.end(), update);
+  EXPECT_EQ(2u, update->second.samples);
+  EXPECT_EQ(150u, update->second.cycles);
+
+  const auto unknown = stacks.find({0x90000000, 0x80001000});
+  ASSERT_NE(stacks.end(), unknown);
+  EXPECT_EQ(25u, unknown->second.cycles);
+
+  EXPECT_EQ(3u, profiler.GetTotal().samples);
+  EXPECT_EQ(175u, profiler.GetTotal().cycles);
+
+  profiler.Clear();
+  EXPECT_TRUE(profiler.GetStacks().empty());
+}
+
+TEST(GuestProfiler, CollapsedStacks)
+{
+  const TestSymbolDB symbol_db;
+  Core::GuestProfiler profiler(Core::System::GetInstance());
+  profiler.AddSample(symbol_db, std::array<u32, 3>{0x80003000, 0x80002000, 0x80001000}, 30);
+  profiler.AddSample(symbol_db, std::array<u32, 1>{0x90000000}, 5);
+
+  std::FILE* const file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  profiler.WriteCollapsedStacks(symbol_db, file);
+
+  // Outermost function first, with the separator escaped out of names
+  EXPECT_EQ("main;update;draw:list 30\n"
+            "90000000 5\n",
+            ReadBack(file));
+}
+
+TEST(GuestProfiler, FunctionReport)
+{
+  const TestSymbolDB symbol_db;
+  Core::GuestProfiler profiler(Core::System::GetInstance());
+  // main -> update -> main, to check that recursion isn't counted twice towards the total
+  profiler.AddSample(symbol_db, std::array<u32, 3>{0x80001000, 0x80002000, 0x80001000}, 75);
+  profiler.AddSample(symbol_db, std::array<u32, 2>{0x80002000, 0x80001000}, 25);
+
+  std::FILE* const file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  profiler.WriteFunctionReport(symbol_db, file);
+
+  EXPECT_EQ("address\tselfCycles\tselfPercent\tselfSamples\ttotalCycles\ttotalPercent"
+            "\ttotalSamples\tsymbol\n"
+            "80001000\t75\t75.000000\t1\t100\t100.000000\t2\t\"main\"\n"
+            "80002000\t25\t25.000000\t1\t100\t100.000000\t2\t\"update\"\n",
+            ReadBack(file));
+}
@@ -0,0 +1,90 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <bit>
+
+#include "Common/CommonTypes.h"
+#include "Common/FloatUtils.h"
+#include "Common/ScopeGuard.h"
+#include "Common/x64ABI.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Jit64/Jit.h"
+#include "Core/PowerPC/Jit64Common/Jit64AsmCommon.h"
+#include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
+#include "Core/System.h"
+
+#include "../TestValues.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+class TestCommonAsmRoutines : public CommonAsmRoutines
+{
+public:
+  explicit TestCommonAsmRoutines(Core::System& system) : CommonAsmRoutines(jit), jit(system)
+  {
+    using namespace Gen;
+
+    AllocCodeSpace(4096);
+    m_const_pool.Init(AllocChildCodeSpace(1024), 1024);
+
+    const auto raw_fres = reinterpret_cast<double (*)(double)>(AlignCode4());
+    GenFres();
+
+    wrapped_fres = reinterpret_cast<u64 (*)(u64, UReg_FPSCR&)>(AlignCode4());
+    ABI_PushRegistersAndAdjustStack(ABI_ALL_CALLEE_SAVED, 8, 16);
+
+    // Like frsqrte, the fres implementation only accesses the fpscr.
+    XOR(32, R(RPPCSTATE), R(RPPCSTATE));
+    LEA(64, RSCRATCH, PPCSTATE(fpscr));
+    SUB(64, R(ABI_PARAM2), R(RSCRATCH));
+    MOV(64, R(RPPCSTATE), R(ABI_PARAM2));
+
+    // Call
+    MOVQ_xmm(XMM0, R(ABI_PARAM1));
+    ABI_CallFunction(raw_fres);
+    MOVQ_xmm(R(ABI_RETURN), XMM0);
+
+    ABI_PopRegistersAndAdjustStack(ABI_ALL_CALLEE_SAVED, 8, 16);
+    RET();
+  }
+
+  u64 (*wrapped_fres)(u64, UReg_FPSCR&);
+  Jit64 jit;
+};
+}  // namespace
+
+TEST(Jit64, Fres)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  const TestCommonAsmRoutines routines(Core::System::GetInstance());
+
+  for (const u64 ivalue : double_test_values)
+  {
+    const double dvalue = std::bit_cast<double>(ivalue);
+
+    const u64 expected = std::bit_cast<u64>(Common::ApproximateReciprocal(dvalue));
+
+    UReg_FPSCR fpscr;
+    const u64 actual = routines.wrapped_fres(ivalue, fpscr);
+
+    if (expected != actual)
+      fmt::print("{:016x} -> {:016x} == {:016x}\n", ivalue, actual, expected);
+
+    EXPECT_EQ(expected, actual);
+    // Like the interpreter, only a zero input raises a division by zero exception
+    EXPECT_EQ(dvalue == 0.0, fpscr.ZX == 1);
+    EXPECT_EQ(dvalue == 0.0, fpscr.FX == 1);
+
+    // Estimating the same value again must not change the flags, so that ps_res can skip the
+    // second estimate when both halves of its input are equal.
+    const UReg_FPSCR first_fpscr = fpscr;
+    EXPECT_EQ(actual, routines.wrapped_fres(ivalue, fpscr));
+    EXPECT_EQ(first_fpscr.Hex, fpscr.Hex);
+  }
+}
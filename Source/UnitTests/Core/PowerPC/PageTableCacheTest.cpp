@@ -0,0 +1,204 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PageTableCache.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+using PowerPC::PageTableCache;
+
+TEST(PageTableCache, LookupAfterInsert)
+{
+  PageTableCache cache;
+  EXPECT_EQ(nullptr, cache.Lookup(0x123, 0x4567));
+
+  cache.Insert(0x123, 0x4567, 0x00300004, 0x80009180);
+  const PageTableCache::Entry* entry = cache.Lookup(0x123, 0x4567);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(0x00300004u, entry->pte_address);
+
+  EXPECT_EQ(1u, cache.GetHits());
+  EXPECT_EQ(1u, cache.GetMisses());
+}
+
+TEST(PageTableCache, TaggedByVSID)
+{
+  PageTableCache cache;
+  cache.Insert(0x123, 0x4567, 0x00300004, 0x80009180);
+
+  // The same page index in another segment must not hit
+  EXPECT_EQ(nullptr, cache.Lookup(0x124, 0x4567));
+  // Neither may a page index which shares the slot
+  EXPECT_EQ(nullptr, cache.Lookup(0x123, 0x4567 + PageTableCache::NUM_ENTRIES));
+  EXPECT_NE(nullptr, cache.Lookup(0x123, 0x4567));
+}
+
+TEST(PageTableCache, Invalidate)
+{
+  PageTableCache cache;
+  cache.Insert(0x123, 0x4567, 0x00300004, 0x80009180);
+  cache.Insert(0x123, 0x0001, 0x00300104, 0x80009180);
+
+  cache.Invalidate(0x4567);
+  EXPECT_EQ(nullptr, cache.Lookup(0x123, 0x4567));
+  EXPECT_NE(nullptr, cache.Lookup(0x123, 0x0001));
+
+  // Like tlbie, this covers the whole congruence class
+  cache.Insert(0x123, 0x4567, 0x00300004, 0x80009180);
+  cache.Invalidate(0x0027);
+  EXPECT_EQ(nullptr, cache.Lookup(0x123, 0x4567));
+  EXPECT_NE(nullptr, cache.Lookup(0x123, 0x0001));
+
+  cache.Clear();
+  EXPECT_EQ(nullptr, cache.Lookup(0x123, 0x0001));
+}
+
+namespace
+{
+constexpr u32 VSID = 0x123;
+constexpr u32 PAGE_TABLE_BASE = 0x00100000;
+constexpr u32 EFFECTIVE_ADDRESS = 0x40001234;
+constexpr u32 PAGE_OFFSET = EFFECTIVE_ADDRESS & 0xfff;
+constexpr u32 PHYSICAL_PAGE = 0x00200000;
+constexpr u32 OTHER_PHYSICAL_PAGE = 0x00300000;
+}  // namespace
+
+// Translates through a page table in emulated memory, with the data MMU enabled
+class PageTableCacheMMUTest : public testing::Test
+{
+protected:
+  PageTableCacheMMUTest()
+      : m_system(Core::System::GetInstance()), m_memory(m_system.GetMemory()),
+        m_mmu(m_system.GetMMU()), m_ppc_state(m_system.GetPPCState())
+  {
+    m_memory.Init();
+    m_ppc_state.msr.DR = 1;
+    m_ppc_state.sr[EFFECTIVE_ADDRESS >> 28] = VSID;
+    m_ppc_state.spr[SPR_SDR] = PAGE_TABLE_BASE;
+    m_mmu.SDRUpdated();
+    m_mmu.ResetPageTableCacheCounters();
+
+    // The first entry of the primary PTEG of the page
+    const u32 page_index = (EFFECTIVE_ADDRESS >> 12) & 0xffff;
+    m_pte_address = ((VSID ^ page_index) & 0x3ff) << 6 | PAGE_TABLE_BASE;
+    UPTE_Lo pte1;
+    pte1.V = 1;
+    pte1.VSID = VSID;
+    pte1.API = (EFFECTIVE_ADDRESS >> 22) & 0x3f;
+    m_memory.Write_U32(pte1.Hex, m_pte_address);
+    SetPTE2(PHYSICAL_PAGE);
+  }
+
+  ~PageTableCacheMMUTest() override
+  {
+    m_ppc_state.tlb = {};
+    m_ppc_state.msr.Hex = 0;
+    m_ppc_state.sr[EFFECTIVE_ADDRESS >> 28] = 0;
+    m_ppc_state.spr[SPR_SDR] = 0;
+    m_mmu.SDRUpdated();
+    m_memory.Shutdown();
+  }
+
+  // Rewrites the second word of the page table entry, like software changing the mapping
+  void SetPTE2(u32 physical_page) { m_memory.Write_U32(physical_page | 0b10, m_pte_address + 4); }
+  UPTE_Hi GetPTE2() const { return UPTE_Hi{m_memory.Read_U32(m_pte_address + 4)}; }
+
+  Core::System& m_system;
+  Memory::MemoryManager& m_memory;
+  PowerPC::MMU& m_mmu;
+  PowerPC::PowerPCState& m_ppc_state;
+  u32 m_pte_address = 0;
+};
+
+TEST_F(PageTableCacheMMUTest, TlbieInvalidates)
+{
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(1u, m_mmu.GetPageTableCache().GetMisses());
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(1u, m_mmu.GetPageTableCache().GetHits());
+
+  // Removing the entry has to be followed by tlbie
+  m_memory.Write_U32(0, m_pte_address);
+  m_mmu.InvalidateTLBEntry(EFFECTIVE_ADDRESS);
+  EXPECT_EQ(std::nullopt, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+
+  // So does moving the page table
+  m_ppc_state.spr[SPR_SDR] = 0;
+  m_mmu.SDRUpdated();
+  EXPECT_EQ(std::nullopt, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+}
+
+TEST_F(PageTableCacheMMUTest, TlbieInvalidatesCongruenceClass)
+{
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(1u, m_mmu.GetPageTableCache().GetMisses());
+
+  // tlbie of another page index in the same class, such as when flushing the whole TLB
+  m_mmu.InvalidateTLBEntry(EFFECTIVE_ADDRESS + 0x40000);
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(2u, m_mmu.GetPageTableCache().GetMisses());
+  EXPECT_EQ(0u, m_mmu.GetPageTableCache().GetHits());
+
+  // A page index in another class keeps its entry
+  m_mmu.InvalidateTLBEntry(EFFECTIVE_ADDRESS + 0x1000);
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(1u, m_mmu.GetPageTableCache().GetHits());
+}
+
+TEST_F(PageTableCacheMMUTest, SeesFirstWordRewritesWithoutTlbie)
+{
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+
+  // Clearing V removes the entry
+  const u32 pte1 = m_memory.Read_U32(m_pte_address);
+  m_memory.Write_U32(pte1 & 0x7fffffff, m_pte_address);
+  EXPECT_EQ(std::nullopt, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+
+  // So does reusing the slot for another virtual page, even with V set
+  m_memory.Write_U32(pte1 ^ 0x1, m_pte_address);
+  EXPECT_EQ(std::nullopt, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+
+  m_memory.Write_U32(pte1, m_pte_address);
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+}
+
+TEST_F(PageTableCacheMMUTest, SeesPTERewrites)
+{
+  EXPECT_EQ(PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+
+  SetPTE2(OTHER_PHYSICAL_PAGE);
+  m_mmu.InvalidateTLBEntry(EFFECTIVE_ADDRESS);
+  EXPECT_EQ(OTHER_PHYSICAL_PAGE | PAGE_OFFSET, m_mmu.GetTranslatedAddress(EFFECTIVE_ADDRESS));
+}
+
+TEST_F(PageTableCacheMMUTest, KeepsPTERewritesWhenSettingReferencedAndChanged)
+{
+  m_memory.Write_U32(0x11111111, PHYSICAL_PAGE | PAGE_OFFSET);
+  m_memory.Write_U32(0x22222222, OTHER_PHYSICAL_PAGE | PAGE_OFFSET);
+
+  EXPECT_EQ(0x11111111u, m_mmu.Read_U32(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(1u, GetPTE2().R);
+  EXPECT_EQ(0u, GetPTE2().C);
+
+  // Software rewrites the entry without tlbie, and the TLB happens to drop the page, so the next
+  // access finds the new entry in the page table
+  SetPTE2(OTHER_PHYSICAL_PAGE);
+  m_ppc_state.tlb = {};
+
+  m_mmu.Write_U32(0x33333333, EFFECTIVE_ADDRESS);
+  EXPECT_EQ(0x11111111u, m_memory.Read_U32(PHYSICAL_PAGE | PAGE_OFFSET));
+  EXPECT_EQ(0x33333333u, m_memory.Read_U32(OTHER_PHYSICAL_PAGE | PAGE_OFFSET));
+
+  const UPTE_Hi pte2 = GetPTE2();
+  EXPECT_EQ(OTHER_PHYSICAL_PAGE >> 12, pte2.RPN);
+  EXPECT_EQ(1u, pte2.R);
+  EXPECT_EQ(1u, pte2.C);
+}
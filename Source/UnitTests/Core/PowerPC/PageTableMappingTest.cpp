@@ -0,0 +1,101 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+constexpr u32 VSID = 0x456;
+constexpr u32 PAGE_TABLE_BASE = 0x00100000;
+// Page index 0x81, which a TLB flush doesn't name, as it only goes over page indices 0 to 0x3f
+constexpr u32 EFFECTIVE_ADDRESS = 0x40081230;
+constexpr u32 PAGE_OFFSET = EFFECTIVE_ADDRESS & 0xfff;
+constexpr u32 PHYSICAL_PAGE = 0x00200000;
+constexpr u32 OTHER_PHYSICAL_PAGE = 0x00300000;
+}  // namespace
+
+// Page table translations which are mirrored into the logical fastmem view
+class PageTableMappingTest : public testing::Test
+{
+protected:
+  PageTableMappingTest()
+      : m_system(Core::System::GetInstance()), m_memory(m_system.GetMemory()),
+        m_mmu(m_system.GetMMU()), m_ppc_state(m_system.GetPPCState())
+  {
+    m_memory.Init();
+    m_memory.InitFastmemArena();
+    m_ppc_state.msr.DR = 1;
+    m_ppc_state.sr[EFFECTIVE_ADDRESS >> 28] = VSID;
+    m_ppc_state.spr[SPR_SDR] = PAGE_TABLE_BASE;
+    m_mmu.SDRUpdated();
+
+    const u32 page_index = (EFFECTIVE_ADDRESS >> 12) & 0xffff;
+    m_pte_address = ((VSID ^ page_index) & 0x3ff) << 6 | PAGE_TABLE_BASE;
+    UPTE_Lo pte1;
+    pte1.V = 1;
+    pte1.VSID = VSID;
+    pte1.API = (EFFECTIVE_ADDRESS >> 22) & 0x3f;
+    m_memory.Write_U32(pte1.Hex, m_pte_address);
+    SetPTE2(PHYSICAL_PAGE);
+  }
+
+  ~PageTableMappingTest() override
+  {
+    m_ppc_state.tlb = {};
+    m_ppc_state.msr.Hex = 0;
+    m_ppc_state.sr[EFFECTIVE_ADDRESS >> 28] = 0;
+    m_ppc_state.spr[SPR_SDR] = 0;
+    m_mmu.SDRUpdated();
+    m_memory.ShutdownFastmemArena();
+    m_memory.Shutdown();
+  }
+
+  void SetPTE2(u32 physical_page) { m_memory.Write_U32(physical_page | 0b10, m_pte_address + 4); }
+
+  // Reads the page the way the JIT's fastmem accesses do, without going through the MMU
+  u32 ReadLogicalView() const
+  {
+    u32 value;
+    std::memcpy(&value, m_memory.GetLogicalBase() + EFFECTIVE_ADDRESS, sizeof(value));
+    return Common::swap32(value);
+  }
+
+  Core::System& m_system;
+  Memory::MemoryManager& m_memory;
+  PowerPC::MMU& m_mmu;
+  PowerPC::PowerPCState& m_ppc_state;
+  u32 m_pte_address = 0;
+};
+
+TEST_F(PageTableMappingTest, TLBFlushUnmapsWholeCongruenceClass)
+{
+  if (!m_memory.CanMapPageTableTranslations())
+    GTEST_SKIP() << "The host can't map single pages into the fastmem arena";
+
+  m_memory.Write_U32(0x11111111, PHYSICAL_PAGE | PAGE_OFFSET);
+  m_memory.Write_U32(0x22222222, OTHER_PHYSICAL_PAGE | PAGE_OFFSET);
+
+  // A store sets both R and C, after which the page gets mapped
+  m_mmu.Write_U32(0x33333333, EFFECTIVE_ADDRESS);
+  ASSERT_EQ(0x33333333u, ReadLogicalView());
+
+  // Move the page, and flush the TLB the way system software does
+  SetPTE2(OTHER_PHYSICAL_PAGE);
+  for (u32 i = 0; i < 64; ++i)
+    m_mmu.InvalidateTLBEntry(i << 12);
+
+  EXPECT_EQ(0x22222222u, m_mmu.Read_U32(EFFECTIVE_ADDRESS));
+  m_mmu.Write_U32(0x44444444, EFFECTIVE_ADDRESS);
+  EXPECT_EQ(0x44444444u, ReadLogicalView());
+  EXPECT_EQ(0x33333333u, m_memory.Read_U32(PHYSICAL_PAGE | PAGE_OFFSET));
+}
@@ -0,0 +1,114 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/StreamADPCM.h"
+
+using namespace StreamADPCM;
+
+namespace
+{
+// The decoder as it was before it decoded whole blocks at once
+class ReferenceDecoder
+{
+public:
+  void DecodeBlock(s16* pcm, const u8* adpcm)
+  {
+    for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+    {
+      pcm[i * 2] = DecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
+                                m_histl1, m_histl2);
+      pcm[i * 2 + 1] = DecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4,
+                                    adpcm[1], m_histr1, m_histr2);
+    }
+  }
+
+private:
+  static s16 DecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
+  {
+    s32 hist = 0;
+    switch (q >> 4)
+    {
+    case 0:
+      hist = 0;
+      break;
+    case 1:
+      hist = (hist1 * 0x3c);
+      break;
+    case 2:
+      hist = (hist1 * 0x73) - (hist2 * 0x34);
+      break;
+    case 3:
+      hist = (hist1 * 0x62) - (hist2 * 0x37);
+      break;
+    }
+    hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
+
+    s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+
+    hist2 = hist1;
+    hist1 = cur;
+
+    cur >>= 6;
+    cur = std::clamp(cur, -0x8000, 0x7fff);
+
+    return (s16)cur;
+  }
+
+  s32 m_histl1 = 0;
+  s32 m_histl2 = 0;
+  s32 m_histr1 = 0;
+  s32 m_histr2 = 0;
+};
+}  // namespace
+
+TEST(StreamADPCM, DecodeBlocksIsBitExact)
+{
+  constexpr std::size_t BLOCK_COUNT = 2000;
+
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> distribution(0, 0xff);
+  std::vector<u8> adpcm(BLOCK_COUNT * ONE_BLOCK_SIZE);
+  for (u8& byte : adpcm)
+    byte = static_cast<u8>(distribution(rng));
+
+  // Every filter and shift combination, including the headers real streams don't use
+  for (std::size_t i = 0; i < 0x100; ++i)
+  {
+    adpcm[i * ONE_BLOCK_SIZE] = static_cast<u8>(i);
+    adpcm[i * ONE_BLOCK_SIZE + 1] = static_cast<u8>(0xff - i);
+  }
+  // Long runs of the loudest samples with the largest gain, to reach the clamping
+  for (std::size_t i = 0x100; i < 0x140; ++i)
+  {
+    adpcm[i * ONE_BLOCK_SIZE] = 0x20;
+    adpcm[i * ONE_BLOCK_SIZE + 1] = 0x30;
+    std::fill_n(&adpcm[i * ONE_BLOCK_SIZE + 4], SAMPLES_PER_BLOCK, i < 0x120 ? 0x77 : 0x88);
+  }
+
+  std::vector<s16> expected(BLOCK_COUNT * SAMPLES_PER_BLOCK * 2);
+  ReferenceDecoder reference;
+  for (std::size_t i = 0; i < BLOCK_COUNT; ++i)
+    reference.DecodeBlock(&expected[i * SAMPLES_PER_BLOCK * 2], &adpcm[i * ONE_BLOCK_SIZE]);
+
+  // Split into batches of different sizes to check that the history carries over
+  std::vector<s16> actual(expected.size());
+  ADPCMDecoder decoder;
+  std::size_t block = 0;
+  for (std::size_t batch = 1; block < BLOCK_COUNT; ++batch)
+  {
+    const std::size_t count = std::min(batch % 7, BLOCK_COUNT - block);
+    decoder.DecodeBlocks(&actual[block * SAMPLES_PER_BLOCK * 2], &adpcm[block * ONE_BLOCK_SIZE],
+                         count);
+    block += count;
+  }
+
+  EXPECT_EQ(expected, actual);
+}
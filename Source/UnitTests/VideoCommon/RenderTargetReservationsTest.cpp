@@ -0,0 +1,110 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/RenderTargetReservations.h"
+#include "VideoCommon/TextureConfig.h"
+
+namespace
+{
+constexpr TextureConfig RENDER_TARGET(640, 528, 1, 1, 1, AbstractTextureFormat::RGBA8,
+                                      AbstractTextureFlag_RenderTarget,
+                                      AbstractTextureType::Texture_2DArray);
+constexpr TextureConfig OTHER_RENDER_TARGET(320, 264, 1, 1, 1, AbstractTextureFormat::RGBA8,
+                                            AbstractTextureFlag_RenderTarget,
+                                            AbstractTextureType::Texture_2DArray);
+
+// Matches TEXTURE_POOL_KILL_THRESHOLD in TextureCacheBase.cpp
+constexpr int POOL_KILL_THRESHOLD = 3;
+
+u32 ClaimAll(RenderTargetReservations& reservations, const TextureConfig& config)
+{
+  u32 claimed = 0;
+  while (reservations.Claim(config))
+    ++claimed;
+  return claimed;
+}
+}  // namespace
+
+TEST(RenderTargetReservations, KeepsRenderTargetUsedEveryFewFrames)
+{
+  // A single pooled render target, aged the way TextureCacheBase::Cleanup ages the texture pool
+  constexpr int INTERVAL = POOL_KILL_THRESHOLD * 4;
+  static_assert(INTERVAL < RenderTargetReservations::RESERVATION_FRAMES);
+
+  RenderTargetReservations reservations;
+  std::optional<int> pooled_frame;
+  int created = 0;
+  for (int frame = 1; frame <= INTERVAL * 20; ++frame)
+  {
+    if (frame % INTERVAL == 1)
+    {
+      reservations.OnAllocated(RENDER_TARGET);
+      if (!pooled_frame)
+        ++created;
+      // Returned to the pool once the copy is done with
+      pooled_frame = frame;
+    }
+
+    reservations.EndFrame();
+    if (pooled_frame)
+    {
+      if (reservations.Claim(RENDER_TARGET))
+        pooled_frame = frame;
+      if (frame > POOL_KILL_THRESHOLD + *pooled_frame)
+        pooled_frame.reset();
+    }
+  }
+
+  EXPECT_EQ(1, created);
+}
+
+TEST(RenderTargetReservations, ReservesPeakAllocationsPerFrame)
+{
+  RenderTargetReservations reservations;
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.OnAllocated(OTHER_RENDER_TARGET);
+  reservations.EndFrame();
+  EXPECT_EQ(3u, ClaimAll(reservations, RENDER_TARGET));
+  EXPECT_EQ(1u, ClaimAll(reservations, OTHER_RENDER_TARGET));
+
+  // Fewer allocations don't lower the reservation right away
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.EndFrame();
+  EXPECT_EQ(3u, ClaimAll(reservations, RENDER_TARGET));
+  EXPECT_EQ(1u, ClaimAll(reservations, OTHER_RENDER_TARGET));
+}
+
+TEST(RenderTargetReservations, DecaysWhenUnused)
+{
+  RenderTargetReservations reservations;
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.EndFrame();
+
+  for (u32 frame = 1; frame < RenderTargetReservations::RESERVATION_FRAMES; ++frame)
+  {
+    reservations.OnAllocated(RENDER_TARGET);
+    reservations.EndFrame();
+    ASSERT_EQ(2u, ClaimAll(reservations, RENDER_TARGET)) << "frame " << frame;
+  }
+
+  // The peak drops to what the last frame allocated, and then goes away entirely
+  reservations.OnAllocated(RENDER_TARGET);
+  reservations.EndFrame();
+  EXPECT_EQ(1u, ClaimAll(reservations, RENDER_TARGET));
+
+  for (u32 frame = 1; frame < RenderTargetReservations::RESERVATION_FRAMES; ++frame)
+  {
+    reservations.EndFrame();
+    ASSERT_EQ(1u, ClaimAll(reservations, RENDER_TARGET)) << "frame " << frame;
+  }
+  reservations.EndFrame();
+  EXPECT_EQ(0u, ClaimAll(reservations, RENDER_TARGET));
+}
@@ -0,0 +1,220 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+#include "VideoCommon/TextureConfig.h"
+
+using namespace VideoCommon;
+
+namespace
+{
+// A texture with one RGBA8 level per size, filled with bytes counting up from first_byte
+CustomTextureData MakeTexture(const std::vector<u32>& sizes, u8 first_byte)
+{
+  CustomTextureData data;
+  auto& slice = data.m_slices.emplace_back();
+  for (const u32 size : sizes)
+  {
+    auto& level = slice.m_levels.emplace_back();
+    level.format = AbstractTextureFormat::RGBA8;
+    level.width = size;
+    level.height = size;
+    level.row_length = size;
+    level.data.reset(size * size * 4);
+    for (std::size_t i = 0; i < level.data.size(); ++i)
+      level.data[i] = static_cast<u8>(first_byte + i);
+  }
+  return data;
+}
+
+bool LevelsMatch(const CustomTextureData& expected, const CustomTextureData& actual)
+{
+  if (actual.m_slices.size() != 1 ||
+      actual.m_slices[0].m_levels.size() != expected.m_slices[0].m_levels.size())
+  {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < actual.m_slices[0].m_levels.size(); ++i)
+  {
+    const auto& expected_level = expected.m_slices[0].m_levels[i];
+    const auto& actual_level = actual.m_slices[0].m_levels[i];
+    if (actual_level.format != expected_level.format ||
+        actual_level.width != expected_level.width ||
+        actual_level.height != expected_level.height ||
+        actual_level.row_length != expected_level.row_length ||
+        !std::ranges::equal(actual_level.data, expected_level.data))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+class TexturePackAssetLibraryTest : public testing::Test
+{
+protected:
+  TexturePackAssetLibraryTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/pack.dtp")
+  {
+  }
+
+  ~TexturePackAssetLibraryTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  // Overwrites a value in the pack, at an offset from the start of the file
+  template <typename T>
+  void Patch(u64 offset, const T& value)
+  {
+    std::string contents;
+    ASSERT_TRUE(File::ReadFileToString(m_path, contents));
+    ASSERT_LE(offset + sizeof(T), contents.size());
+    std::memcpy(contents.data() + offset, &value, sizeof(T));
+    ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+  }
+
+  TexturePack::Header ReadHeader() const
+  {
+    std::string contents;
+    TexturePack::Header header{};
+    if (File::ReadFileToString(m_path, contents) && contents.size() >= sizeof(header))
+      std::memcpy(&header, contents.data(), sizeof(header));
+    return header;
+  }
+
+  const std::string m_directory;
+  const std::string m_path;
+};
+
+TEST_F(TexturePackAssetLibraryTest, RoundTrip)
+{
+  const CustomTextureData mipmapped = MakeTexture({8, 4, 2}, 0);
+  const CustomTextureData single = MakeTexture({5}, 0x80);
+
+  TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path));
+  ASSERT_TRUE(writer.AddTexture("tex1_8x8_mipmapped", true, mipmapped));
+  ASSERT_TRUE(writer.AddTexture("tex1_5x5_single", false, single));
+  EXPECT_EQ(2u, writer.GetTextureCount());
+  ASSERT_TRUE(writer.Finish());
+
+  const auto library = TexturePackAssetLibrary::Open(m_path);
+  ASSERT_NE(nullptr, library);
+  ASSERT_EQ(2u, library->GetTextures().size());
+  EXPECT_TRUE(library->GetTextures().at("tex1_8x8_mipmapped").has_arbitrary_mipmaps);
+  EXPECT_FALSE(library->GetTextures().at("tex1_5x5_single").has_arbitrary_mipmaps);
+
+  for (const auto& [name, texture] : library->GetTextures())
+  {
+    for (const TexturePack::LevelEntry& level : texture.levels)
+      EXPECT_EQ(0u, level.offset % TexturePack::TEXTURE_PACK_ALIGNMENT) << name;
+  }
+
+  CustomTextureData loaded;
+  EXPECT_EQ(8u * 8 * 4 + 4 * 4 * 4 + 2 * 2 * 4,
+            library->LoadTexture("tex1_8x8_mipmapped", &loaded).bytes_loaded);
+  EXPECT_TRUE(LevelsMatch(mipmapped, loaded));
+
+  loaded = {};
+  EXPECT_EQ(5u * 5 * 4, library->LoadTexture("tex1_5x5_single", &loaded).bytes_loaded);
+  EXPECT_TRUE(LevelsMatch(single, loaded));
+
+  loaded = {};
+  EXPECT_EQ(0u, library->LoadTexture("tex1_missing", &loaded).bytes_loaded);
+}
+
+TEST_F(TexturePackAssetLibraryTest, RejectsTruncatedIndex)
+{
+  TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path));
+  ASSERT_TRUE(writer.AddTexture("tex1_4x4", false, MakeTexture({4}, 0)));
+  ASSERT_TRUE(writer.Finish());
+  ASSERT_NE(nullptr, TexturePackAssetLibrary::Open(m_path));
+
+  const TexturePack::Header header = ReadHeader();
+
+  // The index ends before all the textures the header counts
+  Patch(offsetof(TexturePack::Header, texture_count), header.texture_count + 1);
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+  Patch(offsetof(TexturePack::Header, texture_count), header.texture_count);
+
+  // The index runs past the end of the file
+  Patch(offsetof(TexturePack::Header, index_size), header.index_size + 1);
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+  Patch(offsetof(TexturePack::Header, index_size), header.index_size);
+
+  // The file was cut off in the middle of the index
+  std::string contents;
+  ASSERT_TRUE(File::ReadFileToString(m_path, contents));
+  contents.resize(contents.size() - 1);
+  ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+}
+
+TEST_F(TexturePackAssetLibraryTest, RejectsOutOfRangeOffsets)
+{
+  const std::string name = "tex1_4x4";
+  TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path));
+  ASSERT_TRUE(writer.AddTexture(name, false, MakeTexture({4}, 0)));
+  ASSERT_TRUE(writer.Finish());
+
+  const TexturePack::Header header = ReadHeader();
+  const u64 level_entry = header.index_offset + sizeof(TexturePack::TextureEntry) + name.size();
+  const u64 offset_field = level_entry + offsetof(TexturePack::LevelEntry, offset);
+  const u64 size_field = level_entry + offsetof(TexturePack::LevelEntry, size);
+
+  // The level data may only lie between the header and the index
+  Patch(offset_field, header.index_offset);
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+
+  Patch(offset_field, ~u64{0});
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+
+  Patch(offset_field, TexturePack::TEXTURE_PACK_ALIGNMENT);
+  Patch(size_field, header.index_offset);
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+
+  // A size that wraps around when added to the offset
+  Patch(size_field, ~u64{0} - TexturePack::TEXTURE_PACK_ALIGNMENT + 1);
+  EXPECT_EQ(nullptr, TexturePackAssetLibrary::Open(m_path));
+
+  Patch(size_field, u64{4 * 4 * 4});
+  EXPECT_NE(nullptr, TexturePackAssetLibrary::Open(m_path));
+}
+
+TEST_F(TexturePackAssetLibraryTest, FirstTextureOfANameWins)
+{
+  const CustomTextureData first = MakeTexture({4}, 0);
+  const CustomTextureData second = MakeTexture({2}, 0x40);
+
+  TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path));
+  ASSERT_TRUE(writer.AddTexture("tex1_duplicate", false, first));
+  ASSERT_TRUE(writer.AddTexture("tex1_duplicate", true, second));
+  ASSERT_TRUE(writer.Finish());
+
+  const auto library = TexturePackAssetLibrary::Open(m_path);
+  ASSERT_NE(nullptr, library);
+  ASSERT_EQ(1u, library->GetTextures().size());
+  EXPECT_FALSE(library->GetTextures().at("tex1_duplicate").has_arbitrary_mipmaps);
+
+  CustomTextureData loaded;
+  library->LoadTexture("tex1_duplicate", &loaded);
+  EXPECT_TRUE(LevelsMatch(first, loaded));
+}